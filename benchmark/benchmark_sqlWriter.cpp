@@ -0,0 +1,325 @@
+//*********************************************************************************************************************************
+//
+// PROJECT:             General Class Library
+// FILE:                benchmark_sqlWriter.cpp
+// SUBSYSTEM:           Benchmarks
+// LANGUAGE:            C++20
+// TARGET OS:           None - Standard C++
+// NAMESPACE:           GCL
+// AUTHOR:              Gavin Blakeman.
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the General Class Library (GCL)
+//
+//                      GCL is free software: you can redistribute it and/or modify it under the terms of the GNU General
+//                      Public License as published by the Free Software Foundation, either version 2 of the License, or
+//                      (at your option) any later version.
+//
+//                      GCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+//                      implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//                      for more details.
+//
+//                      You should have received a copy of the GNU General Public License along with GCL.  If not,
+//                      see <http://www.gnu.org/licenses/>.
+//
+// OVERVIEW:            Throughput and allocation benchmark of sqlWriter. Each query is measured for all dialects:
+//                        build:  Construction of the query.
+//                        string: Rendering with string().
+//                        append: Rendering with appendTo() into a reused buffer.
+//                      The global operator new/delete are replaced to count allocations. The counts include the
+//                      allocations of the GCL library.
+//
+//                      Usage: GCL_benchmark [filter [minimum time (ms)]]
+//                        filter: Only queries with the filter in their name are run.
+//
+// HISTORY:             2026-10-16 GGB - File Created.
+//
+//*********************************************************************************************************************************
+
+  // Standard C++ library header files
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <functional>
+#include <new>
+#include <string>
+#include <string_view>
+#include <vector>
+
+  // GCL Library header files
+
+#include "include/SQLWriter.h"
+
+namespace
+{
+  /* The benchmark is single threaded, so the counters are not atomic. */
+
+  std::size_t allocationCount = 0;
+  std::size_t allocationBytes = 0;
+
+  void *countedAllocate(std::size_t size, std::size_t alignment)
+  {
+    void *returnValue;
+
+    allocationCount++;
+    allocationBytes += size;
+
+    if (alignment <= alignof(std::max_align_t))
+    {
+      returnValue = std::malloc(size == 0 ? 1 : size);
+    }
+    else
+    {
+      returnValue = std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+    };
+
+    if (returnValue == nullptr)
+    {
+      throw std::bad_alloc();
+    };
+
+    return returnValue;
+  }
+}
+
+void *operator new(std::size_t size) { return countedAllocate(size, 0); }
+void *operator new[](std::size_t size) { return countedAllocate(size, 0); }
+void *operator new(std::size_t size, std::align_val_t alignment) { return countedAllocate(size, static_cast<std::size_t>(alignment)); }
+void *operator new[](std::size_t size, std::align_val_t alignment) { return countedAllocate(size, static_cast<std::size_t>(alignment)); }
+void operator delete(void *p) noexcept { std::free(p); }
+void operator delete[](void *p) noexcept { std::free(p); }
+void operator delete(void *p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void *p, std::size_t) noexcept { std::free(p); }
+void operator delete(void *p, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void *p, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void *p, std::size_t, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void *p, std::size_t, std::align_val_t) noexcept { std::free(p); }
+
+namespace
+{
+  using namespace GCL;
+
+  using builder_t = std::function<void(sqlWriter &)>;
+
+  struct benchmark_t
+  {
+    char const *name;
+    builder_t build;
+  };
+
+  struct result_t
+  {
+    double nsPerOp;
+    double allocationsPerOp;
+    double bytesPerOp;
+  };
+
+  std::size_t sink = 0;     // Rendered lengths. Printed so the rendering is not optimised away.
+
+  constexpr std::size_t WHERE_DEPTH = 32;
+  constexpr std::size_t IN_VALUES = 2000;
+  constexpr std::size_t VALUE_ROWS = 100;
+
+  /* Runs the operation in batches of doubling size until a batch takes at least the minimum time. */
+
+  template<typename F>
+  result_t measure(F &&operation, std::chrono::nanoseconds minimumTime)
+  {
+    using clock = std::chrono::steady_clock;
+
+    std::size_t iterations = 1;
+    std::chrono::nanoseconds elapsed{0};
+    std::size_t allocations = 0;
+    std::size_t bytes = 0;
+
+    operation();      // Warm up.
+
+    while (elapsed < minimumTime)
+    {
+      iterations *= 2;
+
+      std::size_t const startCount = allocationCount;
+      std::size_t const startBytes = allocationBytes;
+      clock::time_point const start = clock::now();
+
+      for (std::size_t index = 0; index < iterations; index++)
+      {
+        operation();
+      };
+
+      elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - start);
+      allocations = allocationCount - startCount;
+      bytes = allocationBytes - startBytes;
+    };
+
+    return { static_cast<double>(elapsed.count()) / iterations,
+             static_cast<double>(allocations) / iterations,
+             static_cast<double>(bytes) / iterations };
+  }
+
+  sqlWriter::whereVariant_t deepWhere()
+  {
+    sqlWriter::whereVariant_t returnValue = where_v("C0", eq, std::int32_t(0));
+
+    for (std::size_t index = 1; index < WHERE_DEPTH; index++)
+    {
+      returnValue = where_v(std::move(returnValue),
+                            (index % 2) ? AND : OR,
+                            where_v("C" + std::to_string(index), gt, static_cast<std::int32_t>(index)));
+    };
+
+    return returnValue;
+  }
+
+  sqlWriter::valueStorage_t valueRows()
+  {
+    sqlWriter::valueStorage_t returnValue;
+
+    for (std::size_t row = 0; row < VALUE_ROWS; row++)
+    {
+      returnValue.push_back({ static_cast<std::int64_t>(row), std::string("name ") + std::to_string(row), 12.5 * row,
+                              std::string("it's") });
+    };
+
+    return returnValue;
+  }
+
+  std::vector<benchmark_t> const benchmarks =
+  {
+    { "select",
+      [](sqlWriter &q)
+      {
+        q.select({"ID", "NAME", "VALUE"}).from("TBL").where("NAME", eq, std::string("abc")).orderBy("NAME", ASC).limit(10);
+      }
+    },
+    { "select_deepWhere",
+      [](sqlWriter &q)
+      {
+        q.select({"ID"}).from("TBL").where(deepWhere());
+      }
+    },
+    { "select_subQuery",
+      [](sqlWriter &q)
+      {
+        sqlWriter inner;
+        sqlWriter source;
+
+        inner.select({"TBL_ID"}).from("OWNER").where("ACTIVE", eq, std::int32_t(1));
+        source.select({"ID", "NAME"}).from("TBL").where("ID", in, std::move(inner));
+        q.select({"ID"}).from(std::move(source), "S").where("NAME", neq, std::string("x"));
+      }
+    },
+    { "select_inSet",
+      [](sqlWriter &q)
+      {
+        sqlWriter::parameterVector_t values;
+
+        values.reserve(IN_VALUES);
+        for (std::size_t index = 0; index < IN_VALUES; index++)
+        {
+          values.emplace_back(static_cast<std::int64_t>(index));
+        };
+        q.select({"ID"}).from("TBL").where("ID", in, std::move(values));
+      }
+    },
+    { "insert_rows",
+      [](sqlWriter &q)
+      {
+        q.insertInto("TBL", {"ID", "NAME", "VALUE", "NOTE"}).values(valueRows());
+      }
+    },
+    { "update",
+      [](sqlWriter &q)
+      {
+        q.update("TBL").set({{"NAME", std::string("abc")}, {"VALUE", 1.5}, {"NOTE", std::string("it's")}})
+         .where(where_v("ID", eq, std::int64_t(7)), AND, where_v("NAME", neq, std::string("x")));
+      }
+    },
+    { "upsert_rows",
+      [](sqlWriter &q)
+      {
+        q.upsert("TBL", {"ID", "NAME", "VALUE", "NOTE"}).values(valueRows()).onConflict({"ID"});
+      }
+    },
+    { "call",
+      [](sqlWriter &q)
+      {
+        q.call("PROC", {std::int32_t(1), std::string("abc"), 2.5, std::int64_t(4)});
+      }
+    },
+  };
+
+  struct dialect_t
+  {
+    char const *name;
+    sqlWriter::EDialect dialect;
+  };
+
+  dialect_t const dialects[] =
+  {
+    { "MYSQL", sqlWriter::MYSQL },
+    { "ORACLE", sqlWriter::ORACLE },
+    { "MICROSOFT", sqlWriter::MICROSOFT },
+    { "POSTGRE", sqlWriter::POSTGRE },
+  };
+
+  void report(char const *name, char const *dialect, char const *operation, result_t const &result)
+  {
+    std::printf("%-18s %-10s %-7s %12.1f %10.2f %12.1f\n",
+                name, dialect, operation, result.nsPerOp, result.allocationsPerOp, result.bytesPerOp);
+  }
+}
+
+int main(int argc, char *argv[])
+{
+  std::string_view const filter = (argc > 1) ? argv[1] : "";
+  std::chrono::nanoseconds const minimumTime = std::chrono::milliseconds((argc > 2) ? std::atoi(argv[2]) : 200);
+  std::string buffer;
+
+  std::printf("%-18s %-10s %-7s %12s %10s %12s\n", "query", "dialect", "op", "ns/op", "allocs/op", "bytes/op");
+
+  for (auto const &benchmark : benchmarks)
+  {
+    if (std::string_view(benchmark.name).find(filter) != std::string_view::npos)
+    {
+      for (auto const &[dialectName, dialect] : dialects)
+      {
+        try
+        {
+          sqlWriter query;
+
+          query.setDialect(dialect);
+          benchmark.build(query);
+
+          report(benchmark.name, dialectName, "build", measure([&]()
+          {
+            sqlWriter q;
+
+            q.setDialect(dialect);
+            benchmark.build(q);
+          }, minimumTime));
+
+          report(benchmark.name, dialectName, "string", measure([&]() { sink += query.string().size(); }, minimumTime));
+
+          report(benchmark.name, dialectName, "append", measure([&]()
+          {
+            buffer.clear();
+            query.appendTo(buffer);
+            sink += buffer.size();
+          }, minimumTime));
+        }
+        catch (std::exception const &e)
+        {
+          std::printf("%-18s %-10s not supported: %s\n", benchmark.name, dialectName, e.what());
+        };
+      };
+    };
+  };
+
+  std::printf("(checksum %zu)\n", sink);
+
+  return 0;
+}
@@ -30,7 +30,24 @@
 //
 // CLASSES INCLUDED:    sqlWriter
 //
-// HISTORY:             2023-09-23 GGB - Extended to support parameterised queries.
+// HISTORY:             2026-10-16 GGB - insertStream() renders INSERT ALL for ORACLE. Added createIntoClause().
+//                      2026-10-16 GGB - sqlSerialiser is a friend. Added tableName_t::name() and alias().
+//                      2026-10-16 GGB - Added fingerprint(), fingerprint128() and normalisedText().
+//                      2026-10-16 GGB - Added multi-row upserts. (upsert(table, {columns}), onConflict())
+//                      2026-10-16 GGB - sqlBatch is a friend.
+//                      2026-10-16 GGB - Added keyset pagination. (seekAfter())
+//                      2026-10-16 GGB - Added strategies for long IN lists. (inList())
+//                      2026-10-16 GGB - Added the optional per query arena. (useArena())
+//                      2026-10-16 GGB - The table/column map is a shared immutable snapshot. (sqlDatabaseMap)
+//                      2026-10-16 GGB - Added fixedDecimal_t parameters and makeDecimal().
+//                      2026-10-16 GGB - Added column-wise insert values. (values(columnStorage_t &&))
+//                      2026-10-16 GGB - Added bulk load output. (PostgreSQL COPY, MySQL LOAD DATA)
+//                      2026-10-16 GGB - Added insertStream() for chunked multi-row inserts.
+//                      2026-10-16 GGB - Added bindValues() for a contiguous bind buffer.
+//                      2026-10-16 GGB - Added compile() to produce a compiled statement with a fixed placeholder slot array.
+//                      2026-10-16 GGB - Added the rendered statement cache for prepared statements.
+//                      2026-10-16 GGB - Rendering writes into a single caller supplied buffer. (appendTo)
+//                      2023-09-23 GGB - Extended to support parameterised queries.
 //                      2023-03-28 GGB - Changed use of GCL::any to std::variant to better support parameterised queries.
 //                      2022-06-07 GGB - Expanded where clause functionality to support a broader range of statements
 //                      2022-05-01 GGB - Added support for "Returning"
@@ -51,6 +68,8 @@
   // Standard Header Files
 
 #include <chrono>
+#include <concepts>
+#include <cstddef>
 #include <cstdint>
 #include <filesystem>
 #include <functional>
@@ -59,9 +78,13 @@
 #include <list>
 #include <map>
 #include <memory>
+#include <memory_resource>
 #include <optional>
+#include <ranges>
 #include <set>
+#include <span>
 #include <string>
+#include <string_view>
 #include <tuple>
 #include <utility>
 #include <variant>
@@ -76,6 +99,9 @@
 
 #include "include/dateTime.h"
 #include "include/error.h"
+#include "include/fixedDecimal.h"
+#include "include/sqlDatabaseMap.h"
+#include "include/sqlStatementCache.h"
 #include "logger/loggerManager.h"
 
 /// @page page2 SQL Writer
@@ -103,6 +129,54 @@ namespace GCL
 
   using decimal_t = boost::multiprecision::number<boost::multiprecision::mpfr_float_backend<65>>;
 
+  /// @brief    The sqlArena is the optional per query arena of a sqlWriter. (See sqlWriter::useArena())
+  /// @details  The arena has a fixed initial buffer. Rewinding the arena returns to the initial buffer, so a query that fits in
+  ///           the initial buffer does not allocate after the first use.
+
+  class sqlArena
+  {
+  public:
+    explicit sqlArena(std::size_t size) : buffer_(new std::byte[size]), resource_(buffer_.get(), size) {}
+    sqlArena(sqlArena const &) = delete;
+    sqlArena &operator=(sqlArena const &) = delete;
+
+    [[nodiscard]] std::pmr::memory_resource *resource() noexcept { return &resource_; }
+    void rewind() noexcept { resource_.release(); }
+
+  private:
+    std::unique_ptr<std::byte[]> buffer_;
+    std::pmr::monotonic_buffer_resource resource_;
+  };
+
+  /// @brief    Deleter for query tree nodes. (Where clause nodes and sub-queries)
+  /// @details  A node is either heap allocated, or allocated from a sqlArena. The deleter shares ownership of the arena so a
+  ///           node can never outlive the memory that it is allocated in. std::unique_ptr<T> converts to a node pointer, so
+  ///           std::make_unique() can still be used to create nodes.
+
+  template<typename T>
+  struct nodeDelete
+  {
+    std::shared_ptr<sqlArena> arena;
+
+    nodeDelete() noexcept = default;
+    explicit nodeDelete(std::shared_ptr<sqlArena> a) noexcept : arena(std::move(a)) {}
+    template<typename U> requires std::convertible_to<U *, T *>
+    nodeDelete(std::default_delete<U> const &) noexcept {}
+
+    void operator()(T *p) const
+    {
+      if (arena)
+      {
+        p->~T();
+        arena->resource()->deallocate(p, sizeof(T), alignof(T));
+      }
+      else
+      {
+        delete p;
+      };
+    }
+  };
+
   enum operator_t
   {
     eq,             ///< equals
@@ -139,22 +213,21 @@ namespace GCL
     JOIN_SELF,      ///< Self Join - This should not be passes to a function, but rather use the self-join function.
   };
 
+  class sqlBatch;
+  class sqlBindBuffer;
+  class sqlCompiledStatement;
+  class sqlSerialiser;
+
   class sqlWriter
   {
-  private:
-    struct SColumnData
-    {
-      std::pair<std::string, std::string> columnName;           ///< TableName, ColumnName
-      bool unique;
-    };
-    typedef std::map<std::string, SColumnData> TColumnMap;
+    friend class sqlBatch;          // Merges and renders insert rows.
+    friend class sqlSerialiser;     // Reads and writes the complete query state.
 
-    struct STableData
-    {
-      std::pair<std::string, std::string> tableName;            ///<
-      TColumnMap columnData;
-    };
-    typedef std::map<std::string, STableData> TDatabaseMap;
+  private:
+    using SColumnData = sqlDatabaseMap::SColumnData;
+    using TColumnMap = sqlDatabaseMap::TColumnMap;
+    using STableData = sqlDatabaseMap::STableData;
+    using TDatabaseMap = sqlDatabaseMap::TDatabaseMap;
 
   public:
     using columnNumber_t = std::uint32_t;
@@ -167,6 +240,24 @@ namespace GCL
       POSTGRE,        ///< Postgre database
     };
 
+    enum EBulkFormat
+    {
+      BULK_TEXT,      ///< COPY text format (POSTGRE) or tab separated file (MYSQL)
+      BULK_BINARY,    ///< COPY binary format (POSTGRE only)
+    };
+
+    /// @brief How an IN/NOT IN list that is longer than the threshold is rendered. (See inList())
+
+    enum EInList
+    {
+      IN_AUTO,        ///< Chosen by the dialect. POSTGRE: IN_ANY, MICROSOFT: IN_VALUES, ORACLE: IN_CHUNKED, MYSQL: IN_LIST
+      IN_LIST,        ///< col IN (a, b, ...)
+      IN_CHUNKED,     ///< ((col IN (a, b)) OR (col IN (c, d))) with at most chunkSize values in each group.
+      IN_ANY,         ///< col = ANY(?) with the values bound as one array. (POSTGRE only)
+      IN_VALUES,      ///< col IN (SELECT v FROM (VALUES (a), (b), ...) AS t(v)) (Not ORACLE)
+      IN_TEMP_TABLE,  ///< col IN (SELECT v FROM tmp_in_col) The temporary table is loaded by inListSetup().
+    };
+
     enum parameterType_t
     {
       PT_NONE,
@@ -196,19 +287,23 @@ namespace GCL
         return (value < rhs.value);
       }
 
+      std::string const &name() const noexcept { return value; }
+
       std::string to_string() const
       {
         std::string rv;
 
-        if ( (value.front() == ':') || (value.front() == '?') )
-        {
-          rv += value;
-        }
-        else
+        appendTo(rv);
+        return rv;
+      }
+
+      void appendTo(std::string &buffer) const
+      {
+        if ( (value.front() != ':') && (value.front() != '?') )
         {
-          rv = ":" + value;
+          buffer += ':';
         }
-        return rv;
+        buffer += value;
       }
     private:
       std::string value;
@@ -243,6 +338,8 @@ namespace GCL
 
       std::string tableDefinition() const { return alias_.empty() ? table_ : table_ + " AS " + alias_; }
       std::string table() const { return alias_.empty() ? table_ : alias_; }
+      std::string const &name() const noexcept { return table_; }
+      std::string const &alias() const noexcept { return alias_; }
     private:
       std::string table_;
       std::string alias_;
@@ -264,7 +361,8 @@ namespace GCL
                                      time_t,
                                      //std::vector<std::uint8_t>,
                                      bindValue_t,
-                                     decimal_t
+                                     decimal_t,
+                                     fixedDecimal_t
                                      >;
 
 
@@ -273,6 +371,7 @@ namespace GCL
 
   public:
     sqlWriter() = default;
+    explicit sqlWriter(std::size_t);
     sqlWriter(sqlWriter const &) = default;
     sqlWriter(sqlWriter &&) = default;
     sqlWriter &operator=(sqlWriter const &) = default;
@@ -282,8 +381,13 @@ namespace GCL
     operator std::string() const { return string(); }
 
     void bindValues(std::list<bindParameter_t> &);
+    void bindValues(sqlBindBuffer &) const;
+    void bulkLoadCommand(std::string &, EBulkFormat = BULK_TEXT, std::string const & = "") const;
+    void bulkLoadPayload(std::string &, EBulkFormat = BULK_TEXT) const;
+    std::size_t bulkLoadStream(rowSource_t const &, statementSink_t const &, EBulkFormat, std::size_t) const;
     sqlWriter &call(std::string const &, std::initializer_list<parameter_t>);
     std::size_t columnCount() const;
+    sqlCompiledStatement compile() const;
     parameterType_t columnType(std::size_t) const;
     sqlWriter &count(std::string const &, std::string const & = "");
     sqlWriter &deleteFrom(std::string const &);
@@ -293,6 +397,7 @@ namespace GCL
     sqlWriter &from(std::string const &, std::optional<std::string> = std::nullopt);
     sqlWriter &from(std::initializer_list<std::string>);
     sqlWriter &from(pointer_t, std::optional<std::string> = std::nullopt);
+    sqlWriter &from(sqlWriter &&, std::optional<std::string> = std::nullopt);
     sqlWriter &groupBy(std::string const &);
     sqlWriter &groupBy(columnNumber_t);
     sqlWriter &groupBy(std::initializer_list<std::string>);
@@ -304,8 +409,42 @@ namespace GCL
     bool hasBindValues(valueType_t const &) const;
     bool hasBindValues(parameter_t const &) const;
     bool hasBindValues(valueStorage_t const &) const;
+    static std::size_t columnLength(column_t const &) noexcept;
     sqlWriter &insertInto(std::string, std::initializer_list<std::string>);
     sqlWriter &insertInto(std::string);
+    sqlWriter &inList(EInList, std::size_t = 1000, std::size_t = 1000);
+    std::size_t inListSetup(statementSink_t const &) const;
+    std::size_t insertStream(rowSource_t const &, statementSink_t const &, std::size_t, std::size_t = 0) const;
+
+    /// @brief      Streams rows from a range into a sequence of multi-row INSERT statements. See insertStream(rowSource_t...)
+    /// @param[in]  rows: The range of rows. Each row is a range of parameter_t with one element per column.
+    /// @param[in]  sink: Called with each completed statement and the number of rows in the statement.
+    /// @param[in]  maxRows: The maximum number of rows in a statement. Zero for no limit.
+    /// @param[in]  maxBytes: The maximum length of a statement in bytes. Zero for no limit.
+    /// @returns    The total number of rows.
+    /// @throws     GCL::CRuntimeAssert
+    /// @version    2026-10-16/GGB - Function created.
+
+    template<std::ranges::input_range R>
+    std::size_t insertStream(R &&rows, statementSink_t const &sink, std::size_t maxRows, std::size_t maxBytes = 0) const
+    {
+      auto iter = std::ranges::begin(rows);
+      auto const last = std::ranges::end(rows);
+
+      return insertStream([&](parameterVector_t &row)
+                          {
+                            bool returnValue = false;
+
+                            if (iter != last)
+                            {
+                              row.assign(std::ranges::begin(*iter), std::ranges::end(*iter));
+                              ++iter;
+                              returnValue = true;
+                            };
+                            return returnValue;
+                          }, sink, maxRows, maxBytes);
+    }
+
     bool isInsertQuery() const { return queryType == qt_insert; }
     bool isSelectQuery() const { return queryType == qt_select; }
     bool isDeleteQuery() const { return queryType == qt_delete; }
@@ -327,6 +466,7 @@ namespace GCL
     sqlWriter &returning(std::string const &);
     sqlWriter &returning(std::initializer_list<std::string>);
     std::size_t rowCount() const;
+    sqlWriter &seekAfter(parameterVector_t);
     sqlWriter &select(std::initializer_list<selectExpression_t>);
     sqlWriter &selfJoin(std::string const &, std::string const &);
     sqlWriter &set(std::string const &, parameter_t const &);
@@ -335,6 +475,8 @@ namespace GCL
     bool shouldParameterise() const;
     sqlWriter &update(std::string const &);
     sqlWriter &upsert(std::string const &);
+    sqlWriter &upsert(std::string const &, std::initializer_list<std::string>);
+    sqlWriter &onConflict(std::initializer_list<std::string>);
 
     /// @brief      Adds a single where clause to the where list.
     /// @param[in]  columnName: The columnName to add
@@ -348,55 +490,135 @@ namespace GCL
     template<typename T>
     sqlWriter &where(std::string const &columnName, operator_t oper, T &&value)
     {
-      whereClause_ = where_v(columnName, oper, value);
+      if constexpr (std::is_same_v<T, sqlWriter>)
+      {
+        whereClause_ = whereVariant_t(columnName, oper, makeNode<sqlWriter>(std::move(value)));
+      }
+      else
+      {
+        whereClause_ = where_v(columnName, oper, value);
+      };
 
       return (*this);
     }
 
     sqlWriter &where(whereVariant_t &&);
+    sqlWriter &where(whereVariant_t &&, logicalOperator_t, whereVariant_t &&);
     std::vector<parameterVariant_t> whereParameters() const;
 
     sqlWriter &values(std::initializer_list<parameterStorage>);
     sqlWriter &values(valueStorage_t &&);
     sqlWriter &values(pointer_t);
+    sqlWriter &values(columnStorage_t &&);
     [[nodiscard]] valueType_t const &values() const noexcept;
 
     std::string string() const;
+    void appendTo(std::string &) const;
+    std::uint64_t shapeKey() const;
+    std::uint64_t fingerprint() const;
+    std::pair<std::uint64_t, std::uint64_t> fingerprint128() const;
+    std::string normalisedText() const;
+
+    static sqlStatementCache &statementCache() noexcept;
 
     virtual void readMapFile(std::filesystem::path const &);
 
     virtual bool createTable(std::string const &tableName);
     virtual bool createColumn(std::string const &tableName, std::string const &columnName);
 
-    std::string getColumnMappedName(std::string const &) const;
-    std::string getTableMappedName(std::string const &) const;
+    std::string_view getColumnMappedName(std::string const &) const noexcept;
+    std::string_view getTableMappedName(std::string const &) const noexcept;
+    std::shared_ptr<sqlDatabaseMap const> const &databaseMap() const noexcept { return databaseMap_; }
+    sqlWriter &useArena(std::size_t = 4096);
+    [[nodiscard]] bool hasArena() const noexcept { return static_cast<bool>(arena_); }
+    sqlWriter &databaseMap(std::shared_ptr<sqlDatabaseMap const>) noexcept;
 
     static std::string sum(std::string const &);
+    static parameter_t makeDecimal(std::string_view);
     static parameterType_t parameterType(parameter_t const &);
     static parameterType_t parameterType(bindParameter_t const &);
 
   private:
     bool verifyOperator(std::string const &) const;
 
+    /// @brief      Creates a query tree node. The node is allocated from the arena if the query has one.
+    /// @param[in]  args: The constructor arguments of the node.
+    /// @returns    The node.
+    /// @throws     std::bad_alloc
+    /// @version    2026-10-16/GGB - Function created.
+
+    template<typename T, typename... Args>
+    std::unique_ptr<T, nodeDelete<T>> makeNode(Args &&... args) const
+    {
+      if (arena_)
+      {
+        void *memory = arena_->resource()->allocate(sizeof(T), alignof(T));
+
+        try
+        {
+          return std::unique_ptr<T, nodeDelete<T>>(new (memory) T(std::forward<Args>(args)...), nodeDelete<T>(arena_));
+        }
+        catch (...)
+        {
+          arena_->resource()->deallocate(memory, sizeof(T), alignof(T));
+          throw;
+        };
+      }
+      else
+      {
+        return std::unique_ptr<T, nodeDelete<T>>(new T(std::forward<Args>(args)...));
+      };
+    }
+
+    void renderQuery(std::string &) const;
+
+    void appendBulkHeader(std::string &, EBulkFormat) const;
+    void appendBulkRow(std::string &, parameterVector_t const &, EBulkFormat) const;
+    void appendBulkTrailer(std::string &, EBulkFormat) const;
+
+    void hashShape(std::uint64_t &, bool = true) const;
+    void hashShape(std::uint64_t &, whereVariant_t const &, bool = true) const;
+    void hashShape(std::uint64_t &, parameter_t const &, bool = true) const;
+
+    void collectSlots(std::vector<parameterType_t> &) const;
+
+    template<typename F>
+    void visitPlaceholders(F &&) const;
+    template<typename F>
+    void visitPlaceholders(F &&, whereVariant_t const &) const;
+    template<typename F>
+    void visitPlaceholder(F &&, parameter_t const &) const;
+
   protected:
     void setTableMap(std::string const &, std::string const &);
     void setColumnMap(std::string const &, std::string const &, std::string const &);
-
-    std::string createSelectQuery() const;
-    std::string createInsertQuery() const;
-    std::string createUpdateQuery() const;
-    std::string createDeleteQuery() const;
-    std::string createUpsertQuery() const;
-    std::string createCall() const;
-
-    std::string createGroupByClause() const;
-    std::string createOrderByClause() const;
-    std::string createSelectClause() const;
-    std::string createFromClause() const;
-    std::string createJoinClause() const;
-    std::string createWhereClause(bool = false) const;
-    std::string createSetClause(bool = false) const;
-    std::string createLimitClause() const;
+    static bool setTableMap(TDatabaseMap &, std::string const &, std::string const &);
+    static bool setColumnMap(TDatabaseMap &, std::string const &, std::string const &, std::string const &);
+
+    void createSelectQuery(std::string &) const;
+    void createInsertQuery(std::string &) const;
+    void createInsertHead(std::string &) const;
+    void createIntoClause(std::string &) const;
+    void createReturningClause(std::string &) const;
+    void createUpdateQuery(std::string &) const;
+    void createDeleteQuery(std::string &) const;
+    void createUpsertQuery(std::string &) const;
+    void createUpsertHead(std::string &) const;
+    void createUpsertTail(std::string &) const;
+    void appendUpsertRow(std::string &, parameterVector_t const &) const;
+    bool isConflictKey(selectExpression_t const &) const;
+    void createCall(std::string &) const;
+
+    void createGroupByClause(std::string &) const;
+    void createOrderByClause(std::string &) const;
+    void createSelectClause(std::string &) const;
+    void createFromClause(std::string &) const;
+    void createJoinClause(std::string &) const;
+    void createWhereClause(std::string &, bool = false) const;
+    void createSetClause(std::string &, bool = false) const;
+    void createLimitClause(std::string &) const;
+    void createSeekClause(std::string &) const;
+    bool seekRowValue() const noexcept;
 
     bool shouldParameterise(whereTest_t const &) const;
     bool shouldParameterise(whereLogical_t const &) const;
@@ -405,18 +627,29 @@ namespace GCL
     bool shouldParameterise(parameter_t const &) const;
     bool shouldParameterise(valueStorage_t const &) const;
 
-    std::string to_string(whereTest_t const &) const;
-    std::string to_string(whereLogical_t const &) const;
-    std::string to_string(whereVariant_t const &) const;
+    void appendTo(std::string &, whereTest_t const &) const;
+    void appendTo(std::string &, whereLogical_t const &) const;
+    template<typename C>
+    void appendInList(std::string &, whereTest_t const &, C const &, EInList) const;
+    EInList inListStrategy(whereTest_t const &) const;
+    std::string inListTable(std::string const &) const;
+    std::string inListColumnType(parameter_t const &, std::size_t) const;
+    void inListSetup(statementSink_t const &, whereVariant_t const &, std::size_t &) const;
+    void appendTo(std::string &, whereVariant_t const &) const;
+
+    void appendTo(std::string &, parameter_t const &) const;
+    void appendTo(std::string &, groupBy_t const &) const;
+    void appendTo(std::string &, selectExpression_t const &) const;
+
+    void appendTo(std::string &, valueType_t const &) const;
+    void appendTo(std::string &, valueStorage_t const &) const;
+    void appendTo(std::string &, columnStorage_t const &) const;
+
+    template<typename C>
+    void appendList(std::string &, C const &) const;
 
-    std::string to_string(parameter_t const &) const;
-    std::string to_string(groupBy_t const &) const;
     std::string to_string(bindValue_t const &);
     std::string to_string(columnRef const &);
-    std::string to_string(selectExpression_t const &) const;
-
-    std::string to_string(valueType_t const &) const;
-    std::string to_string(valueStorage_t const &) const;
 
     void to_parameter(whereTest_t &, std::list<bindParameter_t> &);
     void to_parameter(whereLogical_t &, std::list<bindParameter_t> &);
@@ -0,0 +1,88 @@
+//*********************************************************************************************************************************
+//
+// PROJECT:             General Class Library
+// FILE:                fixedDecimal.h
+// SUBSYSTEM:           Database library
+// LANGUAGE:            C++20
+// TARGET OS:           None - Standard C++
+// NAMESPACE:           GCL
+// AUTHOR:              Gavin Blakeman.
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the General Class Library (GCL)
+//
+//                      GCL is free software: you can redistribute it and/or modify it under the terms of the GNU General
+//                      Public License as published by the Free Software Foundation, either version 2 of the License, or
+//                      (at your option) any later version.
+//
+//                      GCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+//                      implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//                      for more details.
+//
+//                      You should have received a copy of the GNU General Public License along with GCL.  If not,
+//                      see <http://www.gnu.org/licenses/>.
+//
+// OVERVIEW:            A fixed point decimal number stored as a scaled integer. This is used for DECIMAL(p, s) database values
+//                      where p <= 38. It does not allocate.
+//
+// CLASSES INCLUDED:    fixedDecimal_t
+//
+// HISTORY:             2026-10-16 GGB - File Created.
+//
+//*********************************************************************************************************************************
+
+#ifndef GCL_FIXEDDECIMAL_H
+#define GCL_FIXEDDECIMAL_H
+
+  // Standard C++ library header files
+
+#include <charconv>
+#include <compare>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace GCL
+{
+  /// @brief    The fixedDecimal_t type is a decimal number stored as an integer mantissa and a decimal scale.
+  ///           value = mantissa / 10^scale.
+  /// @details  This matches the DECIMAL(p, s) database type for p <= 38. (p <= 18 if the compiler does not provide a 128 bit
+  ///           integer.) Larger precisions should use decimal_t. (See sqlWriter::makeDecimal())
+  ///           The scale is kept, so 1.50 and 1.5 compare equal but are rendered differently.
+
+  class fixedDecimal_t
+  {
+  public:
+#if defined(__SIZEOF_INT128__)
+    using mantissa_t = __int128;
+    static constexpr std::uint8_t MAX_DIGITS = 38;
+#else
+    using mantissa_t = std::int64_t;
+    static constexpr std::uint8_t MAX_DIGITS = 18;
+#endif
+    static constexpr std::size_t MAX_CHARS = MAX_DIGITS + 3;    ///< Sign, leading zero and decimal point.
+
+    constexpr fixedDecimal_t() noexcept = default;
+    constexpr explicit fixedDecimal_t(mantissa_t m, std::uint8_t s = 0) noexcept : mantissa_(m), scale_(s) {}
+    explicit fixedDecimal_t(std::string_view);
+
+    [[nodiscard]] constexpr mantissa_t mantissa() const noexcept { return mantissa_; }
+    [[nodiscard]] constexpr std::uint8_t scale() const noexcept { return scale_; }
+
+    static bool from_chars(std::string_view, fixedDecimal_t &) noexcept;
+    std::to_chars_result to_chars(char *, char *) const noexcept;
+    void appendTo(std::string &) const;
+    [[nodiscard]] std::string str() const;
+
+    [[nodiscard]] std::strong_ordering operator<=>(fixedDecimal_t const &) const noexcept;
+    [[nodiscard]] bool operator==(fixedDecimal_t const &rhs) const noexcept { return (*this <=> rhs) == 0; }
+
+  private:
+    mantissa_t mantissa_ = 0;
+    std::uint8_t scale_ = 0;
+  };
+
+} // namespace GCL
+
+#endif // GCL_FIXEDDECIMAL_H
@@ -27,7 +27,8 @@
 //
 // CLASSES INCLUDED:    CDebugRecord
 //
-// HISTORY:             2024-02-05 GGB - Functions split from loggerCore into separate files
+// HISTORY:             2026-10-16 GGB - Added appendRecordString(). Filters append the text to a buffer supplied by the sink.
+//                      2024-02-05 GGB - Functions split from loggerCore into separate files
 //
 //*********************************************************************************************************************************
 
@@ -45,6 +46,10 @@
 
 namespace GCL::logger
 {
+  /// @brief    Base class for the filters. A filter decides if a record is written, and creates the text that is written.
+  ///           Derived filters override processAppendRecordString(), which appends the text to the sink's buffer.
+  ///           recordString() is provided for callers that need the text on its own.
+
   class CBaseFilter
   {
   public:
@@ -52,9 +57,11 @@ namespace GCL::logger
     virtual ~CBaseFilter() = default;
 
     std::optional<std::string> recordString(CBaseRecord const &r) { return processRecordString(r); }
+    bool appendRecordString(CBaseRecord const &r, std::string &buffer) { return processAppendRecordString(r, buffer); }
 
   private:
     virtual std::optional<std::string> processRecordString(CBaseRecord const &);
+    virtual bool processAppendRecordString(CBaseRecord const &, std::string &);
   };
 } // namespace
 
@@ -27,7 +27,8 @@
 //
 // CLASSES INCLUDED:    CDebugRecord
 //
-// HISTORY:             2024-02-05 GGB - Functions split from loggerCore into separate files
+// HISTORY:             2026-10-16 GGB - processRecordString() replaced by processAppendRecordString().
+//                      2024-02-05 GGB - Functions split from loggerCore into separate files
 //
 //*********************************************************************************************************************************
 
@@ -74,7 +75,7 @@ namespace GCL::logger
     const criticalityMap_t criticalityMap;
     criticalityMask_t criticalityMask;
 
-    virtual std::optional<std::string> processRecordString(const CBaseRecord&);
+    virtual bool processAppendRecordString(CBaseRecord const &, std::string &) override;
   };
 } // namespace
 
@@ -28,7 +28,8 @@
 //
 // CLASSES INCLUDED:    CLogger
 //
-// HISTORY:             2024-02-05 GGB - Rewrite to a flexible approach to enable additional functionality to be added.
+// HISTORY:             2026-10-16 GGB - The writer drains the queue in batches.
+//                      2024-02-05 GGB - Rewrite to a flexible approach to enable additional functionality to be added.
 //                      2022-06-09 GGB - Replace macros TRACENETER and TRACEEXIT with functions.
 //                      2019-10-22 GGB - Changed Boost::thread to std::thread
 //                      2018-08-12 GGB - gnuCash-pud debugging and release.
@@ -120,6 +121,9 @@ namespace GCL::logger
 
     void logMessage(std::unique_ptr<CBaseRecord> &&);
 
+    void batchSize(std::size_t bs) noexcept { batchSize_ = (bs == 0) ? 1 : bs; }
+    std::size_t batchSize() const noexcept { return batchSize_; }
+
     void startup();
     void shutDown();
 
@@ -127,6 +131,7 @@ namespace GCL::logger
 
   protected:
     void writer();
+    void drainQueue();
 
   private:
     CLogger(CLogger const &) = delete;
@@ -141,6 +146,7 @@ namespace GCL::logger
 
     std::string name_;
     std::binary_semaphore messageWaiting;
+    std::atomic<bool> wakePending = false;        // The semaphore has been released and the writer has not woken.
     std::atomic_flag terminateThread;
 
     std::unique_ptr<CBaseQueue> messageQueue;
@@ -148,6 +154,9 @@ namespace GCL::logger
     mutable mutex_type sinkMutex;                 // Mutex protecting the sinks.
     logSinks_t logSinks;
 
+    std::size_t batchSize_ = 1024;                // Maximum records written to the sinks at a time.
+    recordBatch_t batch;                          // Records being written. (Writer thread only)
+
     std::unique_ptr<std::thread> writerThread;
   };
 
@@ -27,7 +27,8 @@
 //
 // CLASSES INCLUDED:
 //
-// HISTORY:             2024-02-05 GGB - Functions split from loggerCore into seperate files
+// HISTORY:             2026-10-16 GGB - Added LOGMESSAGE() with a format string. Trace functions are formatted by the writer.
+//                      2024-02-05 GGB - Functions split from loggerCore into seperate files
 //
 //*********************************************************************************************************************************
 
@@ -36,6 +37,7 @@
 
 // Standard C++ library
 
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <optional>
@@ -45,6 +47,7 @@
 
 #include "include/logger/loggerCore.h"
 #include "include/logger/records/debugRecord.h"
+#include "include/logger/records/formatRecord.h"
 
 namespace GCL::logger
 {
@@ -102,6 +105,20 @@ namespace GCL::logger
     CLoggerManager::defaultLogger().logMessage(std::make_unique<CDebugRecord>(severity, message));
   }
 
+  /// @brief      Function to log a message that is formatted by the writer thread.
+  /// @param[in]  severity: The severity of the message.
+  /// @param[in]  format: The format string. (fmt syntax. Must be a string literal)
+  /// @param[in]  arg, args: The arguments. These are copied into the record.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-16/GGB - Function created.
+
+  template<typename Arg, typename... Args>
+  void LOGMESSAGE(severity_e severity, fmt::format_string<Arg, Args...> format, Arg &&arg, Args &&...args)
+  {
+    CLoggerManager::defaultLogger().logMessage(makeFormatRecord<Arg, Args...>(severity, format, std::forward<Arg>(arg),
+                                                                              std::forward<Args>(args)...));
+  }
+
   /// @brief Function to log a critical message.
   /// @param[in] message: The message to log.
   /// @throws
@@ -203,43 +220,58 @@ namespace GCL::logger
     };
   }
 
+  /* The source_location strings have static storage duration, so the trace records keep the pointers. The records are
+   * created with new as the format string is only checked when it is a constant expression at the call. */
+
+  using traceRecord_t = CFormatRecord<char const *, char const *, std::uint_least32_t>;
+
+  /// @brief      Trace function to trace entry to a function.
+  /// @param[in]  location: Source code location.
+  /// @throws
+  /// @version    2026-10-16/GGB - Formatted by the writer thread.
+
   inline void TRACE_ENTER(std::source_location const location = std::source_location::current())
   {
-    CLoggerManager::defaultLogger().logMessage(std::make_unique<CDebugRecord>(s_trace,
-                               "Entering Function: " + std::string(location.function_name())));
+    CLoggerManager::defaultLogger().logMessage(std::unique_ptr<CBaseRecord>(new CFormatRecord<char const *>(s_trace,
+                               "Entering Function: {}", location.function_name())));
   }
 
+  /// @brief      Trace function to trace exit from a function.
+  /// @param[in]  location: Source code location.
+  /// @throws
+  /// @version    2026-10-16/GGB - Formatted by the writer thread.
+
   inline void TRACE_EXIT(std::source_location const location = std::source_location::current())
   {
-    CLoggerManager::defaultLogger().logMessage(std::make_unique<CDebugRecord>(s_trace,
-                               "Exiting Function: " + std::string(location.function_name())));
+    CLoggerManager::defaultLogger().logMessage(std::unique_ptr<CBaseRecord>(new CFormatRecord<char const *>(s_trace,
+                               "Exiting Function: {}", location.function_name())));
   }
 
 
   /// @brief      Trace function to trace a line.
   /// @param[in]  location: Source code location.
   /// @throws
+  /// @version    2026-10-16/GGB - Formatted by the writer thread.
   /// @version    2023-10-16/GGB - Function created.
 
   inline void TRACE_LINE(std::source_location const location = std::source_location::current())
   {
-    CLoggerManager::defaultLogger().logMessage(std::make_unique<CDebugRecord>(s_trace,
-                               "Passing Line: " + std::string(location.function_name()) +
-                               ". File: " + std::string(location.file_name()) +
-                               ". Line: " + std::to_string(location.line())));
+    CLoggerManager::defaultLogger().logMessage(std::unique_ptr<CBaseRecord>(new traceRecord_t(s_trace,
+                               "Passing Line: {}. File: {}. Line: {}",
+                               location.function_name(), location.file_name(), location.line())));
   }
 
   /// @brief      Trace function to flag an unexpected condition.
   /// @param[in]  location: Source code location.
   /// @throws
+  /// @version    2026-10-16/GGB - Formatted by the writer thread.
   /// @version    2023-10-16/GGB - Function created.
 
   inline void TRACE_UNEXPECTED(std::source_location const location = std::source_location::current())
   {
-    CLoggerManager::defaultLogger().logMessage(std::make_unique<CDebugRecord>(s_trace,
-                               "Unexpected branch: " + std::string(location.function_name()) +
-                               ". File: " + std::string(location.file_name()) +
-                               ". Line: " + std::to_string(location.line())));
+    CLoggerManager::defaultLogger().logMessage(std::unique_ptr<CBaseRecord>(new traceRecord_t(s_trace,
+                               "Unexpected branch: {}. File: {}. Line: {}",
+                               location.function_name(), location.file_name(), location.line())));
   }
 
 } // namespace
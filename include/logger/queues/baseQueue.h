@@ -27,7 +27,9 @@
 //
 // CLASSES INCLUDED:    CBaseQueue
 //
-// HISTORY:             2024-02-05 GGB - Functions split from loggerCore into seperate files
+// HISTORY:             2026-10-16 GGB - Added take(). (Batch removal of records)
+//                      2026-10-16 GGB - Added unsynchronised queues. (The derived queue is thread safe.)
+//                      2024-02-05 GGB - Functions split from loggerCore into seperate files
 //
 //*********************************************************************************************************************************
 
@@ -37,6 +39,7 @@
   // Standard C++ library header files
 
 #include <condition_variable>
+#include <cstddef>
 #include <memory>
 #include <mutex>
 #include <shared_mutex>
@@ -56,10 +59,16 @@ namespace GCL::logger
       CBaseRecord const &front() const;
       void push(std::unique_ptr<CBaseRecord> &&);
       void pop();
+      std::size_t take(recordBatch_t &, std::size_t);
 
       bool empty() const noexcept;
 
     protected:
+      /// @brief      Constructor for queues that are thread safe without the queue mutex. (Lock free queues)
+      /// @param[in]  s: false if the queue mutex is not required.
+
+      explicit CBaseQueue(bool s) : synchronised_(s) {}
+
       using mutex_type = std::shared_mutex;
       using writeLock = std::unique_lock<mutex_type>;
       using readLock = std::unique_lock<mutex_type>;
@@ -67,6 +76,8 @@ namespace GCL::logger
       mutable mutex_type queueMutex;
       mutable std::condition_variable_any cvQueueData;
 
+      bool const synchronised_ = true;    ///< false if the derived queue does not need the queue mutex.
+
     private:
       CBaseQueue(CBaseQueue const &) = delete;
       CBaseQueue(CBaseQueue &&) = delete;
@@ -76,6 +87,7 @@ namespace GCL::logger
       virtual CBaseRecord const &processFront() const = 0;
       virtual void processPush(std::unique_ptr<CBaseRecord> &&) = 0;
       virtual void processPop() = 0;
+      virtual std::unique_ptr<CBaseRecord> processTake() = 0;
       virtual bool processEmpty() const noexcept = 0;
   };
 }
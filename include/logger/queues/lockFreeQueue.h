@@ -0,0 +1,93 @@
+﻿//*********************************************************************************************************************************
+//
+// PROJECT:             General Class Library
+// FILE:                lockFreeQueue.h
+// SUBSYSTEM:           Logging Functions
+// LANGUAGE:            C++20
+// TARGET OS:           None - Standard C++
+// NAMESPACE:           GCL
+// AUTHOR:              Gavin Blakeman.
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the General Class Library (GCL)
+//
+//                      GCL is free software: you can redistribute it and/or modify it under the terms of the GNU General
+//                      Public License as published by the Free Software Foundation, either version 2 of the License, or
+//                      (at your option) any later version.
+//
+//                      GCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+//                      implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//                      for more details.
+//
+//                      You should have received a copy of the GNU General Public License along with GCL.  If not,
+//                      see <http://www.gnu.org/licenses/>.
+//
+// OVERVIEW:            Lock free multiple producer, single consumer record queue.
+//
+// CLASSES INCLUDED:    CLockFreeQueue
+//
+// HISTORY:             2026-10-16 GGB - The queue is intrusive. Records are linked through CBaseRecord.
+//                      2026-10-16 GGB - Added processTake().
+//                      2026-10-16 GGB - File Created.
+//
+//*********************************************************************************************************************************
+
+#ifndef GCL_LOGGER_QUEUES_LOCKFREEQUEUE_H
+#define GCL_LOGGER_QUEUES_LOCKFREEQUEUE_H
+
+// Standard C++ library
+
+#include <atomic>
+#include <memory>
+
+// GCL header files
+
+#include "include/logger/queues/baseQueue.h"
+
+namespace GCL::logger
+{
+  /// @brief    FIFO queue that does not use the queue mutex. Any number of threads can push records. Only one thread (the
+  ///           logger writer thread) may call front(), pop(), take() and empty().
+  /// @details  The queue is intrusive. Records are linked through their own link (CBaseRecord::next_), so a push does not
+  ///           allocate. A producer links a record with a single atomic exchange of the head, so producers never wait for
+  ///           each other or for the writer. The writer owns the tail and follows the links without a lock.
+  ///           A record can only be removed once it has a successor, as the producer that pushed the record after it still
+  ///           writes to its link. The queue holds a stub record that is pushed behind the last record when required.
+  ///           A record that is being linked by a producer that was pre-empted between the exchange and the link is not
+  ///           visible to the writer until the link is stored. The producer then releases the logger semaphore, so the
+  ///           record is not lost.
+
+  class CLockFreeQueue : public CBaseQueue
+  {
+  public:
+    CLockFreeQueue();
+    virtual ~CLockFreeQueue();
+
+  private:
+    CLockFreeQueue(CLockFreeQueue const &) = delete;
+    CLockFreeQueue(CLockFreeQueue &&) = delete;
+    CLockFreeQueue &operator=(CLockFreeQueue const &) = delete;
+    CLockFreeQueue &operator=(CLockFreeQueue &&) = delete;
+
+    class CStubRecord : public CBaseRecord
+    {
+    };
+
+    alignas(64) mutable std::atomic<CBaseRecord *> head_;   ///< Last record pushed. (Producers)
+    alignas(64) mutable CBaseRecord *tail_;                 ///< Front record, or the stub. (Writer only)
+    mutable CStubRecord stub_;                              ///< Marks the end of the queue when the writer reaches the head.
+
+    void link(CBaseRecord *) const noexcept;
+    CBaseRecord *frontRecord() const noexcept;
+
+    virtual CBaseRecord const &processFront() const override;
+    virtual void processPush(std::unique_ptr<CBaseRecord> &&) override;
+    virtual void processPop() override;
+    virtual std::unique_ptr<CBaseRecord> processTake() override;
+    virtual bool processEmpty() const noexcept override;
+  };
+
+}
+
+#endif // GCL_LOGGER_QUEUES_LOCKFREEQUEUE_H
@@ -27,7 +27,8 @@
 //
 // CLASSES INCLUDED:    CQueueQueue
 //
-// HISTORY:             2024-02-05 GGB - Functions split from loggerCore into seperate files
+// HISTORY:             2026-10-16 GGB - Added processTake().
+//                      2024-02-05 GGB - Functions split from loggerCore into seperate files
 //
 //*********************************************************************************************************************************
 
@@ -61,6 +62,7 @@ namespace GCL::logger
     virtual CBaseRecord const &processFront() const override;
     virtual void processPush(std::unique_ptr<CBaseRecord> &&) override;
     virtual void processPop() override;
+    virtual std::unique_ptr<CBaseRecord> processTake() override;
     virtual bool processEmpty() const noexcept override;
   };
 
@@ -0,0 +1,116 @@
+﻿//*********************************************************************************************************************************
+//
+// PROJECT:             General Class Library
+// FILE:                ringQueue.h
+// SUBSYSTEM:           Logging Functions
+// LANGUAGE:            C++20
+// TARGET OS:           None - Standard C++
+// NAMESPACE:           GCL
+// AUTHOR:              Gavin Blakeman.
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the General Class Library (GCL)
+//
+//                      GCL is free software: you can redistribute it and/or modify it under the terms of the GNU General
+//                      Public License as published by the Free Software Foundation, either version 2 of the License, or
+//                      (at your option) any later version.
+//
+//                      GCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+//                      implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//                      for more details.
+//
+//                      You should have received a copy of the GNU General Public License along with GCL.  If not,
+//                      see <http://www.gnu.org/licenses/>.
+//
+// OVERVIEW:            Bounded record queue with overflow policies.
+//
+// CLASSES INCLUDED:    CRingQueue
+//
+// HISTORY:             2026-10-16 GGB - Added processTake().
+//                      2026-10-16 GGB - File Created.
+//
+//*********************************************************************************************************************************
+
+#ifndef GCL_LOGGER_QUEUES_RINGQUEUE_H
+#define GCL_LOGGER_QUEUES_RINGQUEUE_H
+
+// Standard C++ library
+
+#include <atomic>
+#include <cstdint>
+#include <set>
+#include <vector>
+
+// GCL header files
+
+#include "include/logger/queues/baseQueue.h"
+#include "include/logger/records/debugRecord.h"
+
+namespace GCL::logger
+{
+  /// @brief    FIFO queue with a fixed capacity. The slots are allocated when the queue is constructed, so the queue never
+  ///           grows. When the queue is full a push is handled by the overflow policy:
+  ///             block:          The producer waits until the writer has taken a record.
+  ///             dropNewest:     The new record is discarded.
+  ///             dropOldest:     The oldest record that the writer has not started on is discarded.
+  ///             dropSeverity:   Records with a severity in the kept set (eg s_critical, s_error) are never discarded.
+  ///                             A new record with any other severity is discarded. A new kept record discards the oldest
+  ///                             record that is not kept. If all the records are kept, the producer waits.
+  ///           Records that are not CDebugRecords are treated as kept.
+  /// @note     With the block and dropSeverity policies the logger must be started, or a producer can wait forever.
+
+  class CRingQueue : public CBaseQueue
+  {
+  public:
+    using severity_t = CDebugRecord::severity_t;
+    using severityMask_t = std::set<severity_t>;
+
+    enum EOverflowPolicy
+    {
+      block,            ///< Wait for space.
+      dropNewest,       ///< Discard the new record.
+      dropOldest,       ///< Discard the oldest record.
+      dropSeverity,     ///< Discard records that are not in the kept set.
+    };
+
+    CRingQueue(std::size_t, EOverflowPolicy = block);
+    CRingQueue(std::size_t, severityMask_t &&);
+    virtual ~CRingQueue() = default;
+
+    [[nodiscard]] std::size_t capacity() const noexcept { return slots.size(); }
+    [[nodiscard]] EOverflowPolicy policy() const noexcept { return policy_; }
+    [[nodiscard]] std::uint64_t dropped() const noexcept { return dropped_.load(std::memory_order_relaxed); }
+    [[nodiscard]] std::uint64_t blocked() const noexcept { return blocked_.load(std::memory_order_relaxed); }
+
+  private:
+    CRingQueue() = delete;
+    CRingQueue(CRingQueue const &) = delete;
+    CRingQueue(CRingQueue &&) = delete;
+    CRingQueue &operator=(CRingQueue const &) = delete;
+    CRingQueue &operator=(CRingQueue &&) = delete;
+
+    std::vector<std::unique_ptr<CBaseRecord>> slots;
+    std::size_t head = 0;                     ///< Slot of the front record.
+    std::size_t count = 0;                    ///< Number of records in the queue.
+    mutable bool frontTaken = false;          ///< The writer holds a reference to the front record. (Not discarded)
+    EOverflowPolicy policy_;
+    severityMask_t keptSeverities;
+    std::atomic<std::uint64_t> dropped_ = 0;  ///< Records discarded by the overflow policy.
+    std::atomic<std::uint64_t> blocked_ = 0;  ///< Pushes that waited for space.
+
+    std::size_t slot(std::size_t n) const noexcept { return (head + n) % slots.size(); }
+    bool kept(CBaseRecord const &) const;
+    bool discard(std::size_t);
+    bool discardNotKept();
+
+    virtual CBaseRecord const &processFront() const override;
+    virtual void processPush(std::unique_ptr<CBaseRecord> &&) override;
+    virtual void processPop() override;
+    virtual std::unique_ptr<CBaseRecord> processTake() override;
+    virtual bool processEmpty() const noexcept override;
+  };
+
+}
+
+#endif // GCL_LOGGER_QUEUES_RINGQUEUE_H
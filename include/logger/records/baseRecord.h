@@ -27,7 +27,12 @@
 //
 // CLASSES INCLUDED:    CBaseRecord
 //
-// HISTORY:             2024-02-05 GGB - Functions split from loggerCore into seperate files
+// HISTORY:             2026-10-16 GGB - Added appendText() so sinks can format records without a temporary string.
+//                      2026-10-16 GGB - Added the queue link used by CLockFreeQueue.
+//                      2026-10-16 GGB - Records are allocated from CRecordPool.
+//                      2026-10-16 GGB - text() calls processText() so derived records can create the text when it is written.
+//                      2026-10-16 GGB - Added recordBatch_t.
+//                      2024-02-05 GGB - Functions split from loggerCore into seperate files
 //
 //*********************************************************************************************************************************
 
@@ -37,30 +42,55 @@
   // Standard C++ library header
 
 #include <any>
+#include <atomic>
 #include <chrono>
+#include <memory>
 #include <string>
 #include <ostream>
+#include <vector>
+
+  // GCL header files
+
+#include "include/logger/records/recordPool.h"
 
 namespace GCL::logger
 {
+  class CLockFreeQueue;
+
   class CBaseRecord
   {
   public:
-    CBaseRecord(std::string const &txt) : recordText(txt) {}
+    CBaseRecord(std::string txt) : recordText(std::move(txt)) {}
     virtual ~CBaseRecord() = default;
 
-    std::string text() const noexcept { return recordText; }
+    static void *operator new(std::size_t size) { return CRecordPool::allocate(size); }
+    static void operator delete(void *p, std::size_t size) noexcept { CRecordPool::deallocate(p, size); }
+
+    std::string text() const { return processText(); }
+    void appendText(std::string &buffer) const { processAppendText(buffer); }
+
+  protected:
+    CBaseRecord() = default;
+
+    std::string const &storedText() const noexcept { return recordText; }
+
+    virtual std::string processText() const { return recordText; }
+    virtual void processAppendText(std::string &buffer) const { buffer += processText(); }
 
   private:
-    CBaseRecord() = delete;
     CBaseRecord(CBaseRecord const &) = delete;
     CBaseRecord(CBaseRecord &&) = delete;
     CBaseRecord &operator=(CBaseRecord const &) = delete;
     CBaseRecord &operator=(CBaseRecord &&) = delete;
 
     std::string recordText;
+    std::atomic<CBaseRecord *> next_ = nullptr;       ///< Link to the next record in a CLockFreeQueue.
+
+    friend class CLockFreeQueue;
   };
 
+  using recordBatch_t = std::vector<std::unique_ptr<CBaseRecord>>;   ///< Records taken from a queue in one operation.
+
   std::ostream& operator<<(std::ostream&, CBaseRecord const &);
 } // namespace
 
@@ -27,7 +27,11 @@
 //
 // CLASSES INCLUDED:    CDebugRecord
 //
-// HISTORY:             2024-02-05 GGB - Functions split from loggerCore into seperate files
+// HISTORY:             2026-10-16 GGB - Added inlineBuffer() for derived records.
+//                      2026-10-16 GGB - Added processAppendText().
+//                      2026-10-16 GGB - Short messages are stored in the record.
+//                      2026-10-16 GGB - Added constructor for records that create their text.
+//                      2024-02-05 GGB - Functions split from loggerCore into seperate files
 //
 //*********************************************************************************************************************************
 
@@ -37,6 +41,8 @@
 // Standard C++ library
 
 #include <cstdint>
+#include <string>
+#include <string_view>
 
 // GCL header files
 
@@ -45,17 +51,30 @@
 
 namespace GCL::logger
 {
+  /// @brief    Record with a severity and a time stamp. Messages of up to INLINE_TEXT_SIZE characters are stored in the record,
+  ///           so creating the record does not allocate a string.
+
   class CDebugRecord : public CBaseRecord
   {
   public:
     using severity_t = std::uint32_t;
 
-    CDebugRecord(severity_t, std::string const &);
+    static constexpr std::size_t INLINE_TEXT_SIZE = 112;
+
+    CDebugRecord(severity_t, std::string_view);
     virtual ~CDebugRecord() = default;
 
     severity_t severity() const noexcept { return severity_; }
     dateTime_t timeStamp() const noexcept { return timeStamp_; }
 
+  protected:
+    explicit CDebugRecord(severity_t);
+
+    /// @brief    The inline text buffer. (INLINE_TEXT_SIZE characters) Only for derived records that create their text, and
+    ///           override processText() and processAppendText().
+
+    char *inlineBuffer() noexcept { return inlineText_; }
+
   private:
     CDebugRecord() = delete;
     CDebugRecord(CDebugRecord const &) = delete;
@@ -64,7 +83,12 @@ namespace GCL::logger
     CDebugRecord &operator=(CDebugRecord &&) = delete;
 
     severity_t severity_;
+    std::uint8_t inlineSize_ = 0;             ///< Characters in inlineText_. 0 if the text is held by CBaseRecord.
     dateTime_t timeStamp_;
+    char inlineText_[INLINE_TEXT_SIZE];
+
+    virtual std::string processText() const override;
+    virtual void processAppendText(std::string &) const override;
 
   };
 } // namespace
@@ -0,0 +1,264 @@
+﻿//*********************************************************************************************************************************
+//
+// PROJECT:             General Class Library
+// FILE:                formatRecord.h
+// SUBSYSTEM:           Logging Functions
+// LANGUAGE:            C++20
+// TARGET OS:           None - Standard C++
+// NAMESPACE:           GCL
+// AUTHOR:              Gavin Blakeman.
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the General Class Library (GCL)
+//
+//                      GCL is free software: you can redistribute it and/or modify it under the terms of the GNU General
+//                      Public License as published by the Free Software Foundation, either version 2 of the License, or
+//                      (at your option) any later version.
+//
+//                      GCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+//                      implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//                      for more details.
+//
+//                      You should have received a copy of the GNU General Public License along with GCL.  If not,
+//                      see <http://www.gnu.org/licenses/>.
+//
+// OVERVIEW:            Debug record that is formatted by the writer thread.
+//
+// CLASSES INCLUDED:    CFormatString
+//                      CFormatRecord
+//
+// HISTORY:             2026-10-16 GGB - String arguments are held in the record's inline buffer. (CFormatString)
+//                      2026-10-16 GGB - Added processAppendText().
+//                      2026-10-16 GGB - File Created.
+//
+//*********************************************************************************************************************************
+
+#ifndef GCL_LOGGER_RECORDS_FORMATRECORD_H
+#define GCL_LOGGER_RECORDS_FORMATRECORD_H
+
+// Standard C++ library
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+// Miscellaneous library header files.
+
+#include <fmt/format.h>
+
+// GCL header files
+
+#include "include/logger/records/debugRecord.h"
+
+namespace GCL::logger
+{
+  /// @brief    A string argument of a CFormatRecord. The characters are either held in the inline buffer of the record, or
+  ///           on the heap if they do not fit. (16 bytes, so that records with several strings fit in a pool block)
+
+  class CFormatString
+  {
+  public:
+    /// @brief      Copies the text into the buffer of the record.
+    /// @param[in]  buffer: The buffer. Must have space for the text.
+    /// @param[in]  text: The text to copy.
+    /// @throws     None.
+    /// @version    2026-10-16/GGB - Function created.
+
+    CFormatString(char *buffer, std::string_view text) noexcept
+      : data_(buffer), size_(static_cast<std::uint32_t>(text.copy(buffer, text.size()))) {}
+
+    /// @brief      Copies the text onto the heap.
+    /// @param[in]  text: The text to copy. (Only the first 4 GiB are kept)
+    /// @throws     std::bad_alloc
+    /// @version    2026-10-16/GGB - Function created.
+
+    explicit CFormatString(std::string_view text) : size_(static_cast<std::uint32_t>(text.size())), heap_(true)
+    {
+      char *buffer = new char[size_];
+
+      text.copy(buffer, size_);
+      data_ = buffer;
+    }
+
+    CFormatString(CFormatString &&other) noexcept
+      : data_(other.data_), size_(other.size_), heap_(std::exchange(other.heap_, false)) {}
+
+    ~CFormatString()
+    {
+      if (heap_)
+      {
+        delete [] data_;
+      };
+    }
+
+    std::string_view view() const noexcept { return std::string_view(data_, size_); }
+    bool isInline() const noexcept { return !heap_; }
+
+  private:
+    CFormatString() = delete;
+    CFormatString(CFormatString const &) = delete;
+    CFormatString &operator=(CFormatString const &) = delete;
+    CFormatString &operator=(CFormatString &&) = delete;
+
+    char const *data_;
+    std::uint32_t size_;
+    bool heap_ = false;                         ///< true if data_ was allocated by the string.
+  };
+
+  /// @brief    The type that an argument of makeFormatRecord() is stored as. Strings, character pointers and string views are
+  ///           stored as CFormatString, as the characters they refer to may not outlive the record. Other types are stored by
+  ///           value.
+
+  template<typename T>
+  using formatArgument_t = std::conditional_t<std::is_convertible_v<std::decay_t<T>, std::string_view>,
+                                              CFormatString,
+                                              std::decay_t<T>>;
+
+  /// @brief    Debug record that holds a format string and a copy of its arguments. The text is only formatted when the
+  ///           record is written. (On the writer thread)
+  /// @details  The format string is checked against the argument types when the record is created. Only a view of the
+  ///           format string is kept, so it must be a string literal. (Or have static storage duration)
+  ///           Records created by makeFormatRecord() copy string arguments into the inline buffer of the record. The strings
+  ///           share the CDebugRecord::INLINE_TEXT_SIZE (112) characters of the buffer, in the order of the arguments. A
+  ///           string that does not fit in the space that is left is copied to the heap. A record with up to 112 characters of
+  ///           string arguments is created with a single allocation from the record pool, as long as the record fits in a
+  ///           pool block. (eg Three string arguments. Larger records are allocated from the heap)
+  ///           Records created with the constructor store the argument types as given.
+
+  template<typename... Args>
+  class CFormatRecord : public CDebugRecord
+  {
+  public:
+    CFormatRecord(severity_t s, fmt::format_string<Args...> f, Args... args)
+      : CDebugRecord(s), format_(static_cast<fmt::string_view>(f)), arguments(std::move(args)...) {}
+
+    /// @brief      Constructor used by makeFormatRecord(). String arguments are copied into the record.
+    /// @param[in]  std::in_place: Selects this constructor.
+    /// @param[in]  s: The severity of the message.
+    /// @param[in]  f: The format string. (Already checked against the arguments)
+    /// @param[in]  values: The arguments. Each value is converted to the argument type of the record.
+    /// @throws     std::bad_alloc
+    /// @version    2026-10-16/GGB - Function created.
+
+    template<typename... Ts>
+    CFormatRecord(std::in_place_t, severity_t s, fmt::string_view f, Ts &&... values)
+      : CFormatRecord(std::size_t(0), s, f, std::forward<Ts>(values)...) {}
+
+    virtual ~CFormatRecord() = default;
+
+  private:
+    CFormatRecord() = delete;
+    CFormatRecord(CFormatRecord const &) = delete;
+    CFormatRecord(CFormatRecord &&) = delete;
+    CFormatRecord &operator=(CFormatRecord const &) = delete;
+    CFormatRecord &operator=(CFormatRecord &&) = delete;
+
+    fmt::string_view format_;
+    std::tuple<Args...> arguments;
+
+    /// @brief      Stores the arguments. The arguments are stored in order. (Braced initialisation)
+    /// @param[in]  inlineUsed: Characters of the inline buffer used. Only needed while the arguments are stored.
+    /// @param[in]  s: The severity of the message.
+    /// @param[in]  f: The format string.
+    /// @param[in]  values: The arguments.
+    /// @throws     std::bad_alloc
+    /// @version    2026-10-16/GGB - Function created.
+
+    template<typename... Ts>
+    CFormatRecord(std::size_t inlineUsed, severity_t s, fmt::string_view f, Ts &&... values)
+      : CDebugRecord(s), format_(f), arguments{store<Args>(inlineUsed, std::forward<Ts>(values))...} {}
+
+    /// @brief      Converts a value to the argument type. Strings are copied to the inline buffer if there is space, otherwise
+    ///             to the heap.
+    /// @param[in,out] inlineUsed: Characters of the inline buffer used.
+    /// @param[in]  value: The value.
+    /// @returns    The argument.
+    /// @throws     std::bad_alloc
+    /// @version    2026-10-16/GGB - Function created.
+
+    template<typename A, typename T>
+    A store(std::size_t &inlineUsed, T &&value)
+    {
+      if constexpr (std::is_same_v<A, CFormatString>)
+      {
+        std::string_view const text(value);
+
+        if (text.size() <= INLINE_TEXT_SIZE - inlineUsed)
+        {
+          char *const buffer = inlineBuffer() + inlineUsed;
+
+          inlineUsed += text.size();
+          return CFormatString(buffer, text);
+        }
+        else
+        {
+          return CFormatString(text);
+        };
+      }
+      else
+      {
+        return A(std::forward<T>(value));
+      };
+    }
+
+    /// @brief      Formats the record text.
+    /// @returns    The text of the record.
+    /// @throws     std::bad_alloc
+    /// @version    2026-10-16/GGB - Function created.
+
+    virtual std::string processText() const override
+    {
+      return std::apply([this](auto const &...a) { return fmt::vformat(format_, fmt::make_format_args(a...)); }, arguments);
+    }
+
+    /// @brief      Formats the record text directly into a buffer.
+    /// @param[out] buffer: The buffer to append the text to.
+    /// @throws     std::bad_alloc
+    /// @version    2026-10-16/GGB - Function created.
+
+    virtual void processAppendText(std::string &buffer) const override
+    {
+      std::apply([this, &buffer](auto const &...a)
+                 {
+                   fmt::vformat_to(std::back_inserter(buffer), format_, fmt::make_format_args(a...));
+                 }, arguments);
+    }
+  };
+
+  /// @brief      Creates a record that is formatted by the writer thread.
+  /// @param[in]  s: The severity of the message.
+  /// @param[in]  f: The format string. (fmt syntax. Must be a string literal)
+  /// @param[in]  args: The arguments. These are copied into the record. (See CFormatRecord for strings)
+  /// @returns    The record.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-16/GGB - String arguments are copied into the record. (CFormatString)
+  /// @version    2026-10-16/GGB - Function created.
+
+  template<typename... Args>
+  std::unique_ptr<CBaseRecord> makeFormatRecord(CDebugRecord::severity_t s, fmt::format_string<Args...> f, Args &&...args)
+  {
+    return std::make_unique<CFormatRecord<formatArgument_t<Args>...>>(std::in_place, s, static_cast<fmt::string_view>(f),
+                                                                      std::forward<Args>(args)...);
+  }
+
+} // namespace
+
+/// @brief    Formats a CFormatString as its text.
+
+template<>
+struct fmt::formatter<GCL::logger::CFormatString> : fmt::formatter<fmt::string_view>
+{
+  auto format(GCL::logger::CFormatString const &s, format_context &ctx) const
+  {
+    return fmt::formatter<fmt::string_view>::format(fmt::string_view(s.view().data(), s.view().size()), ctx);
+  }
+};
+
+#endif // GCL_LOGGER_RECORDS_FORMATRECORD_H
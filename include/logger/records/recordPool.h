@@ -0,0 +1,99 @@
+//*********************************************************************************************************************************
+//
+// PROJECT:             General Class Library
+// FILE:                recordPool.h
+// SUBSYSTEM:           Logging Functions
+// LANGUAGE:            C++20
+// TARGET OS:           None - Standard C++
+// NAMESPACE:           GCL
+// AUTHOR:              Gavin Blakeman.
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the General Class Library (GCL)
+//
+//                      GCL is free software: you can redistribute it and/or modify it under the terms of the GNU General
+//                      Public License as published by the Free Software Foundation, either version 2 of the License, or
+//                      (at your option) any later version.
+//
+//                      GCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+//                      implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//                      for more details.
+//
+//                      You should have received a copy of the GNU General Public License along with GCL.  If not,
+//                      see <http://www.gnu.org/licenses/>.
+//
+// OVERVIEW:            Per thread memory pools for log records.
+//
+// CLASSES INCLUDED:    CRecordPool
+//
+// HISTORY:             2026-10-16 GGB - Added slabs().
+//                      2026-10-16 GGB - File Created.
+//
+//*********************************************************************************************************************************
+
+#ifndef GCL_LOGGER_RECORDS_RECORDPOOL_H
+#define GCL_LOGGER_RECORDS_RECORDPOOL_H
+
+// Standard C++ library
+
+#include <atomic>
+#include <cstddef>
+
+namespace GCL::logger
+{
+  /// @brief    Memory pool for log records. Each thread that creates records has its own pool. A pool is a free list of
+  ///           fixed size blocks, allocated in slabs. Once the pool has grown to the number of records in flight, creating
+  ///           and destroying records does not call the heap.
+  /// @details  Records are usually destroyed by the logger writer thread, not the thread that created them. Each block holds
+  ///           a pointer to the pool that owns it. A thread that destroys a record from another pool collects the blocks
+  ///           and returns them to the owner's remote list as a chain, with a single atomic operation. (flushReturns())
+  ///           The owner takes the whole remote list with one atomic exchange when its free list is empty.
+  ///           When a thread ends, its pool is kept for the next thread that creates records. Pools and slabs are never
+  ///           released, so the memory used is bounded by the peak number of records and threads.
+  ///           Records larger than a block are allocated from the heap.
+
+  class CRecordPool
+  {
+  public:
+    static constexpr std::size_t BLOCK_SIZE = 256;          ///< Size of a block, including the header.
+    static constexpr std::size_t SLAB_BLOCKS = 64;          ///< Number of blocks allocated at a time.
+    static constexpr std::size_t RETURN_BATCH = 64;         ///< Maximum blocks held by a thread before they are returned.
+
+    [[nodiscard]] static void *allocate(std::size_t);
+    static void deallocate(void *, std::size_t) noexcept;
+    static void flushReturns() noexcept;
+    [[nodiscard]] static std::size_t slabs() noexcept;
+
+  private:
+    CRecordPool() = default;
+    CRecordPool(CRecordPool const &) = delete;
+    CRecordPool(CRecordPool &&) = delete;
+    CRecordPool &operator=(CRecordPool const &) = delete;
+    CRecordPool &operator=(CRecordPool &&) = delete;
+
+    struct block_t
+    {
+      CRecordPool *owner;                                   ///< nullptr if allocated from the heap.
+      block_t *next;                                        ///< Next free block.
+    };
+
+    static constexpr std::size_t HEADER_SIZE = alignof(std::max_align_t);
+    static constexpr std::size_t PAYLOAD_SIZE = BLOCK_SIZE - HEADER_SIZE;
+
+    block_t *freeList = nullptr;                            ///< Owner thread only.
+    alignas(64) std::atomic<block_t *> remoteList = nullptr; ///< Blocks returned by other threads.
+
+    static CRecordPool &threadPool();
+    static block_t *blockOf(void *p) noexcept { return reinterpret_cast<block_t *>(static_cast<char *>(p) - HEADER_SIZE); }
+    static void *payloadOf(block_t *b) noexcept { return reinterpret_cast<char *>(b) + HEADER_SIZE; }
+
+    block_t *take();
+    void pushRemote(block_t *, block_t *) noexcept;
+
+    friend struct threadState_t;
+  };
+
+} // namespace
+
+#endif // GCL_LOGGER_RECORDS_RECORDPOOL_H
@@ -27,7 +27,8 @@
 //
 // CLASSES INCLUDED:    CDebugRecord
 //
-// HISTORY:             2024-02-05 GGB - Functions split from loggerCore into separate files
+// HISTORY:             2026-10-16 GGB - Added writeRecords() and the flush policy.
+//                      2024-02-05 GGB - Functions split from loggerCore into separate files
 //
 //*********************************************************************************************************************************
 
@@ -36,7 +37,12 @@
 
 // Standard C++ library
 
+#include <chrono>
+#include <cstdint>
 #include <memory>
+#include <optional>
+#include <set>
+#include <string>
 
 // GCL header files
 
@@ -47,18 +53,47 @@ namespace GCL::logger
 {
   /* Template type is the filter to be used with the sink. */
 
+  /// @brief    Base class for the sinks. The logger writes each batch of records to a sink with writeRecords(). When the sink
+  ///           is flushed is decided by the flush policy:
+  ///             flushBatch:     After every batch.
+  ///             flushInterval:  When the interval has passed since the last flush. The logger checks idle sinks when the
+  ///                             interval ends, so no record waits for more than the interval.
+  ///             flushSeverity:  After a batch that holds a record with a severity in the flush set. (eg s_critical) Otherwise
+  ///                             as flushInterval.
+
   class CBaseSink
   {
   public:
+    using clock_type = std::chrono::steady_clock;
+    using severityMask_t = std::set<std::uint32_t>;
+
+    enum EFlushPolicy
+    {
+      flushBatch,         ///< Flush after every batch.
+      flushInterval,      ///< Flush when the interval has passed.
+      flushSeverity,      ///< Flush after a record with a flush severity, or when the interval has passed.
+    };
+
     CBaseSink(std::shared_ptr<CBaseFilter>);
     virtual ~CBaseSink() = default;
 
     virtual void writeRecord(CBaseRecord const &) = 0;
+    void writeRecords(recordBatch_t const &);
     CBaseFilter &filter() { return *filter_; }
     std::shared_ptr<CBaseFilter>  getFilter() { return filter_; }
 
+    void flushPolicy(EFlushPolicy, std::chrono::milliseconds = std::chrono::milliseconds(1000), severityMask_t && = {});
+    void flush();
+    void flushIfDue(clock_type::time_point);
+    [[nodiscard]] std::optional<clock_type::time_point> flushDue() const noexcept;
+
   protected:
     std::shared_ptr<CBaseFilter> filter_;
+    std::string buffer_;              ///< Output of a batch. Kept between batches to avoid allocation.
+
+    void formatRecords(recordBatch_t const &);
+    virtual void processWriteRecords(recordBatch_t const &);
+    virtual void processFlush() {}
 
   private:
     CBaseSink() = delete;
@@ -67,6 +102,13 @@ namespace GCL::logger
     CBaseSink &operator=(CBaseSink const &) = delete;
     CBaseSink &operator=(CBaseSink &&) = delete;
 
+    EFlushPolicy flushPolicy_ = flushBatch;
+    std::chrono::milliseconds flushInterval_ = std::chrono::milliseconds(1000);
+    severityMask_t flushSeverities;
+    bool unflushed = false;                       ///< Records have been written since the last flush.
+    clock_type::time_point lastFlush = clock_type::now();
+
+    bool hasFlushSeverity(recordBatch_t const &) const;
   };
 } // namespace
 
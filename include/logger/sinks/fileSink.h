@@ -28,7 +28,9 @@
 //
 // CLASSES INCLUDED:    CLogger
 //
-// HISTORY:             2024-02-05 GGB - Rewrite to a flexible approach to enable additional functionality to be added.
+// HISTORY:             2026-10-16 GGB - Size rotation is checked before each record of a batch is written.
+//                      2026-10-16 GGB - Added processWriteRecords() and processFlush().
+//                      2024-02-05 GGB - Rewrite to a flexible approach to enable additional functionality to be added.
 //                      2023-11-01 GGB - ADD deletion of unsed constructors. (Move and operator =)
 //                      2015-09-22 GGB - AIRDAS 2015.09 release
 //                      2014-12-25 GGB - Development of class for "Observatory Weather System - Service"
@@ -51,6 +53,10 @@
 
 namespace GCL::logger
 {
+  /// @brief    Sink that writes to a log file, with rotation of the log files.
+  /// @details  With size rotation the file is rotated before a record that would take it over the rotation size. A log file is
+  ///           only larger than the rotation size if it holds a single record that is larger than the rotation size.
+
   class CFileSink : public CBaseSink
   {
   public:
@@ -78,6 +84,8 @@ namespace GCL::logger
 
     virtual void rotateLogFile();
     virtual void writeRecord(CBaseRecord const &);
+    virtual void processWriteRecords(recordBatch_t const &) override;
+    virtual void processFlush() override;
 
   private:
     CFileSink() = delete;
@@ -90,6 +98,7 @@ namespace GCL::logger
     std::filesystem::path logFileName;
     std::filesystem::path logFileExt;
     std::filesystem::path openLogFileName;
+    std::uintmax_t logFileSize = 0;                 ///< Bytes in the open log file. (Including unflushed bytes)
 
     // Daily based rotation variables
 
@@ -103,6 +112,8 @@ namespace GCL::logger
     bool useUTC = true;                             ///< Use UTC for determining start of days.
 
     void rollFiles(void);
+    void checkRotation();
+    void writeBuffer(std::size_t);
 
   };
 
@@ -31,7 +31,8 @@
 // CLASS HEIRARCHY:     CLoggerSink
 //                        - CStreamSink
 //
-// HISTORY:             2024-02-05 GGB - Rewrite to a flexible approach to enable additional functionality to be added.
+// HISTORY:             2026-10-16 GGB - Added processWriteRecords() and processFlush().
+//                      2024-02-05 GGB - Rewrite to a flexible approach to enable additional functionality to be added.
 //                      2015-09-22 GGB - AIRDAS 2015.09 release
 //                      2014-12-28 GGB - Development of class for "Observatory Weather System - Service"
 //
@@ -59,6 +60,10 @@ namespace GCL::logger
 
     virtual void writeRecord(CBaseRecord const &);
 
+  protected:
+    virtual void processWriteRecords(recordBatch_t const &) override;
+    virtual void processFlush() override;
+
   private:
     CStreamSink() = delete;
     CStreamSink(CStreamSink const &) = delete;
@@ -0,0 +1,111 @@
+//*********************************************************************************************************************************
+//
+// PROJECT:             General Class Library
+// FILE:                sqlBatch.h
+// SUBSYSTEM:           Database library
+// LANGUAGE:            C++20
+// TARGET OS:           None - Standard C++
+// NAMESPACE:           GCL
+// AUTHOR:              Gavin Blakeman.
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the General Class Library (GCL)
+//
+//                      GCL is free software: you can redistribute it and/or modify it under the terms of the GNU General
+//                      Public License as published by the Free Software Foundation, either version 2 of the License, or
+//                      (at your option) any later version.
+//
+//                      GCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+//                      implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//                      for more details.
+//
+//                      You should have received a copy of the GNU General Public License along with GCL.  If not,
+//                      see <http://www.gnu.org/licenses/>.
+//
+// OVERVIEW:            A batch of sqlWriter statements that is rendered as a single script. The script can be sent to the
+//                      database server in one round trip.
+//
+// CLASSES INCLUDED:    sqlBatch
+//
+// HISTORY:             2026-10-16 GGB - File Created.
+//
+//*********************************************************************************************************************************
+
+#ifndef GCL_SQLBATCH_H
+#define GCL_SQLBATCH_H
+
+  // Standard C++ library header files
+
+#include <cstddef>
+#include <string>
+#include <variant>
+#include <vector>
+
+  // GCL Library header files
+
+#include "include/SQLWriter.h"
+
+namespace GCL
+{
+  class sqlBindBuffer;
+
+  /// @brief    The sqlBatch holds a sequence of INSERT/UPDATE/DELETE (or other) statements and savepoints. It renders them as
+  ///           one script, wrapped in a transaction, with a combined bind buffer in statement order.
+  /// @details  An INSERT that follows an INSERT into the same table with the same columns is merged into the earlier statement,
+  ///           so a sequence of single row inserts becomes one multi-row insert. Inserts with a RETURNING clause, column-wise
+  ///           values or a sub-query are not merged. ORACLE inserts are not merged, as ORACLE does not support multi-row VALUES.
+  ///           In prepared statements an insert has one row of placeholders for each row of values.
+  ///           The transaction syntax is:
+  ///             MYSQL:      START TRANSACTION; ... COMMIT;
+  ///             POSTGRE:    BEGIN; ... COMMIT;
+  ///             MICROSOFT:  BEGIN TRANSACTION; ... COMMIT TRANSACTION;
+  ///             ORACLE:     BEGIN ... COMMIT; END;  (An anonymous block)
+  /// @note     MYSQL requires CLIENT_MULTI_STATEMENTS to execute a script. POSTGRE only accepts a script without
+  ///           placeholders in a single query. A script with placeholders must be sent in pipeline mode.
+
+  class sqlBatch
+  {
+  public:
+    explicit sqlBatch(sqlWriter::EDialect, std::size_t = 1000);
+    sqlBatch(sqlBatch const &) = delete;
+    sqlBatch(sqlBatch &&) = default;
+    sqlBatch &operator=(sqlBatch const &) = delete;
+    sqlBatch &operator=(sqlBatch &&) = default;
+    ~sqlBatch() = default;
+
+    [[nodiscard]] sqlWriter::EDialect dialect() const noexcept { return dialect_; }
+    [[nodiscard]] std::size_t size() const noexcept { return entries_.size(); }
+    [[nodiscard]] bool empty() const noexcept { return entries_.empty(); }
+
+    sqlBatch &add(sqlWriter &&);
+    sqlBatch &savepoint(std::string const &);
+    sqlBatch &releaseSavepoint(std::string const &);
+    sqlBatch &transaction(bool t = true) noexcept { transaction_ = t; return *this; }
+    void clear() noexcept;
+
+    void appendTo(std::string &) const;
+    [[nodiscard]] std::string string() const;
+    void bindValues(sqlBindBuffer &) const;
+
+  private:
+    struct savepoint_t
+    {
+      std::string name;
+      bool release;
+    };
+    using entry_t = std::variant<sqlWriter, savepoint_t>;
+
+    sqlWriter::EDialect dialect_;
+    std::size_t maxInsertRows_;         ///< The largest merged insert. (rows)
+    bool transaction_ = true;
+    std::vector<entry_t> entries_;
+
+    bool merge(sqlWriter &);
+    void appendStatement(std::string &, sqlWriter const &) const;
+    void appendSavepoint(std::string &, savepoint_t const &) const;
+  };
+
+} // namespace GCL
+
+#endif // GCL_SQLBATCH_H
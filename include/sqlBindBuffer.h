@@ -0,0 +1,171 @@
+﻿//*********************************************************************************************************************************
+//
+// PROJECT:             General Class Library
+// FILE:                sqlBindBuffer.h
+// SUBSYSTEM:           Database library
+// LANGUAGE:            C++20
+// TARGET OS:           None - Standard C++
+// NAMESPACE:           GCL
+// AUTHOR:              Gavin Blakeman.
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the General Class Library (GCL)
+//
+//                      GCL is free software: you can redistribute it and/or modify it under the terms of the GNU General
+//                      Public License as published by the Free Software Foundation, either version 2 of the License, or
+//                      (at your option) any later version.
+//
+//                      GCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+//                      implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//                      for more details.
+//
+//                      You should have received a copy of the GNU General Public License along with GCL.  If not,
+//                      see <http://www.gnu.org/licenses/>.
+//
+// OVERVIEW:            A contiguous buffer of bind values for a prepared statement. The buffer is laid out so that it can be
+//                      handed to a database driver without converting each parameter.
+//
+// CLASSES INCLUDED:    sqlBindBuffer
+//
+// HISTORY:             2026-10-16 GGB - Added typed push_back() for column-wise values.
+//                      2026-10-16 GGB - File Created.
+//
+//*********************************************************************************************************************************
+
+#ifndef GCL_SQLBINDBUFFER_H
+#define GCL_SQLBINDBUFFER_H
+
+  // Standard C++ library header files
+
+#include <charconv>
+#include <concepts>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+  // GCL Library header files
+
+#include "include/SQLWriter.h"
+
+namespace GCL
+{
+  /// @brief    The sqlBindBuffer holds the bind values of a prepared statement as a structure of arrays.
+  /// @details  Each parameter has a type tag, an 8 byte value slot, a length and a format. Numbers are stored in the value slot
+  ///           in native byte order. Strings, decimals and dates are stored as text in a single shared byte arena and the value
+  ///           slot holds the offset into the arena. Text in the arena is NUL terminated.
+  ///           MySQL: buffer(), length(), isUnsigned() and type() map directly onto the MYSQL_BIND fields.
+  ///           PostgreSQL: paramValues(), paramLengths() and paramFormats() can be passed directly to PQexecParams(). For the
+  ///           POSTGRE dialect, numbers are also written as text so that every parameter uses the text format.
+  ///           Parameters with no value (named bind values) are NULL. buffer() returns nullptr.
+  ///           clear() keeps the capacity, so re-filling the buffer for the next row does not allocate.
+
+  class sqlBindBuffer
+  {
+  public:
+    using parameterType_t = sqlWriter::parameterType_t;
+
+    enum EFormat
+    {
+      FMT_TEXT = 0,       ///< Matches the libpq text format code.
+      FMT_BINARY = 1,     ///< Matches the libpq binary format code.
+    };
+
+    sqlBindBuffer(sqlWriter::EDialect = sqlWriter::MYSQL);
+    sqlBindBuffer(sqlBindBuffer const &) = default;
+    sqlBindBuffer(sqlBindBuffer &&) = default;
+    sqlBindBuffer &operator=(sqlBindBuffer const &) = default;
+    sqlBindBuffer &operator=(sqlBindBuffer &&) = default;
+    ~sqlBindBuffer() = default;
+
+    [[nodiscard]] sqlWriter::EDialect dialect() const noexcept { return dialect_; }
+    [[nodiscard]] std::size_t size() const noexcept { return types_.size(); }
+    [[nodiscard]] bool empty() const noexcept { return types_.empty(); }
+
+    void clear() noexcept;
+    void reserve(std::size_t, std::size_t = 0);
+    void push_back(sqlWriter::parameter_t const &);
+    void push_back(std::string const &value) { appendText(sqlWriter::PT_STRING, value); }
+
+    /// @brief      Appends a column-wise cell without constructing a parameter_t.
+    /// @param[in]  value: The value to append.
+    /// @throws     std::bad_alloc
+    /// @version    2026-10-16/GGB - Function created.
+
+    template<typename T>
+      requires std::same_as<T, std::int64_t> || std::same_as<T, double> || std::same_as<T, std::string_view>
+    void push_back(T value)
+    {
+      if constexpr (std::same_as<T, std::string_view>)
+      {
+        appendText(sqlWriter::PT_STRING, value);
+      }
+      else
+      {
+        appendNumber(std::same_as<T, double> ? sqlWriter::PT_DOUBLE : sqlWriter::PT_I64, value);
+      };
+    }
+    void push_null();
+
+    [[nodiscard]] parameterType_t type(std::size_t index) const { return types_[index]; }
+    [[nodiscard]] void const *buffer(std::size_t) const noexcept;
+    [[nodiscard]] int length(std::size_t index) const { return lengths_[index]; }
+    [[nodiscard]] int format(std::size_t index) const { return formats_[index]; }
+    [[nodiscard]] bool isNull(std::size_t index) const { return types_[index] == sqlWriter::PT_NONE; }
+    [[nodiscard]] bool isUnsigned(std::size_t) const noexcept;
+    [[nodiscard]] std::string_view text(std::size_t) const;
+
+    [[nodiscard]] std::vector<parameterType_t> const &types() const noexcept { return types_; }
+    [[nodiscard]] char const * const *paramValues() const;
+    [[nodiscard]] int const *paramLengths() const noexcept { return lengths_.data(); }
+    [[nodiscard]] int const *paramFormats() const noexcept { return formats_.data(); }
+    [[nodiscard]] std::string_view arena() const noexcept { return arena_; }
+
+  private:
+    sqlWriter::EDialect dialect_;
+    std::vector<parameterType_t> types_;          ///< Type tag of each parameter.
+    std::vector<std::uint64_t> slots_;            ///< Fixed width value, or offset into the arena.
+    std::vector<int> lengths_;                    ///< Length of the value in bytes. (Excludes the NUL terminator.)
+    std::vector<int> formats_;                    ///< FMT_TEXT or FMT_BINARY.
+    std::string arena_;                           ///< Text values, NUL terminated.
+    mutable std::vector<char const *> pointers_;  ///< Resolved by paramValues(). The arena may move while filling.
+
+    /// @brief      Appends a number to the buffer. For the POSTGRE dialect the number is written as text into the arena.
+    /// @param[in]  type: The type tag of the number.
+    /// @param[in]  value: The value to append.
+    /// @throws     std::bad_alloc
+    /// @version    2026-10-16/GGB - Function created.
+
+    template<typename T>
+    void appendNumber(parameterType_t type, T value)
+    {
+      if (dialect_ == sqlWriter::POSTGRE)
+      {
+        char text[32];
+        auto const [end, ec] = std::to_chars(text, text + sizeof(text), value);
+
+        appendText(type, std::string_view(text, static_cast<std::size_t>(end - text)));
+      }
+      else
+      {
+        std::uint64_t slot = 0;
+
+        std::memcpy(&slot, &value, sizeof(T));
+        types_.push_back(type);
+        slots_.push_back(slot);
+        lengths_.push_back(static_cast<int>(sizeof(T)));
+        formats_.push_back(FMT_BINARY);
+      };
+    }
+    void appendText(parameterType_t, std::string_view);
+    void beginText(parameterType_t);
+    void endText();
+
+    friend struct parameter_to_bind;
+  };
+
+} // namespace GCL
+
+#endif // GCL_SQLBINDBUFFER_H
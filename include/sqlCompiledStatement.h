@@ -0,0 +1,144 @@
+﻿//*********************************************************************************************************************************
+//
+// PROJECT:             General Class Library
+// FILE:                sqlCompiledStatement.h
+// SUBSYSTEM:           Database library
+// LANGUAGE:            C++20
+// TARGET OS:           None - Standard C++
+// NAMESPACE:           GCL
+// AUTHOR:              Gavin Blakeman.
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the General Class Library (GCL)
+//
+//                      GCL is free software: you can redistribute it and/or modify it under the terms of the GNU General
+//                      Public License as published by the Free Software Foundation, either version 2 of the License, or
+//                      (at your option) any later version.
+//
+//                      GCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+//                      implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//                      for more details.
+//
+//                      You should have received a copy of the GNU General Public License along with GCL.  If not,
+//                      see <http://www.gnu.org/licenses/>.
+//
+// OVERVIEW:            A compiled prepared statement. The SQL text and the placeholder slots are fixed when the statement is
+//                      compiled. Values are then bound into the slots without walking the query tree.
+//
+// CLASSES INCLUDED:    sqlCompiledStatement
+//
+// HISTORY:             2026-10-16 GGB - bindRow() forwards its arguments, so temporary strings are rejected.
+//                      2026-10-16 GGB - Added fixedDecimal_t slot values.
+//                      2026-10-16 GGB - File Created.
+//
+//*********************************************************************************************************************************
+
+#ifndef GCL_SQLCOMPILEDSTATEMENT_H
+#define GCL_SQLCOMPILEDSTATEMENT_H
+
+  // Standard C++ library header files
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+#include <vector>
+
+  // GCL Library header files
+
+#include "include/SQLWriter.h"
+
+namespace GCL
+{
+  /// @brief    The sqlCompiledStatement is produced by sqlWriter::compile(). It holds the final text of a prepared statement and
+  ///           a flat array of placeholder slots, in the order that the placeholders appear in the text.
+  /// @details  The text and the slot types are fixed at compile time. Each slot also holds a bound value. Binding writes
+  ///           directly into the slot array, so binding a new row is O(parameters) and does not allocate.
+  ///           Strings and decimals are bound by reference. The referenced values must outlive the execution of the
+  ///           statement. (This matches the bindValues() behaviour of sqlWriter.) Decimals are bound with std::cref().
+  ///           A slot with type PT_NONE (a named bind value) accepts a value of any type.
+
+  class sqlCompiledStatement
+  {
+  public:
+    using parameterType_t = sqlWriter::parameterType_t;
+
+      /// The alternatives are in the same order as parameterType_t. The index of the bound value is therefore its type.
+      /// fixedDecimal_t is the exception. It is added last and is a PT_DECIMAL.
+
+    using slotValue_t = std::variant<std::monostate,
+                                     std::uint8_t,
+                                     std::uint16_t,
+                                     std::uint32_t,
+                                     std::uint64_t,
+                                     std::int8_t,
+                                     std::int16_t,
+                                     std::int32_t,
+                                     std::int64_t,
+                                     float,
+                                     double,
+                                     date_t,
+                                     time_t,
+                                     dateTime_t,
+                                     std::reference_wrapper<decimal_t const>,
+                                     std::string_view,
+                                     fixedDecimal_t>;
+
+    sqlCompiledStatement(std::string &&, std::vector<parameterType_t> &&);
+    sqlCompiledStatement(sqlCompiledStatement const &) = default;
+    sqlCompiledStatement(sqlCompiledStatement &&) = default;
+    sqlCompiledStatement &operator=(sqlCompiledStatement const &) = default;
+    sqlCompiledStatement &operator=(sqlCompiledStatement &&) = default;
+    ~sqlCompiledStatement() = default;
+
+    [[nodiscard]] std::string const &sql() const noexcept { return sqlText; }
+    [[nodiscard]] std::size_t slotCount() const noexcept { return slotTypes.size(); }
+    [[nodiscard]] parameterType_t slotType(std::size_t) const;
+    [[nodiscard]] slotValue_t const &slot(std::size_t) const;
+    [[nodiscard]] std::vector<parameterType_t> const &slots() const noexcept { return slotTypes; }
+    [[nodiscard]] bool isBound() const noexcept;
+
+    sqlCompiledStatement &bind(std::size_t, slotValue_t const &);
+    sqlCompiledStatement &bind(std::size_t index, std::string const &value)
+    {
+      return bind(index, slotValue_t(std::in_place_type<std::string_view>, value));
+    }
+    sqlCompiledStatement &bind(std::size_t, std::string &&) = delete;    ///< The slot would refer to a temporary.
+    void clearBindings() noexcept;
+
+    /// @brief      Binds a complete row of values. The values are bound to the slots in order.
+    /// @details    The values are forwarded to bind(). Temporary strings and decimals are rejected at compile time, as the slots
+    ///             would refer to them after they are destroyed.
+    /// @param[in]  values: The values to bind. There must be one value for each slot.
+    /// @returns    (*this)
+    /// @throws     GCL::CRuntimeAssert
+    /// @throws     GCL::runtime_error
+    /// @version    2026-10-16/GGB - The values are forwarded. (Temporaries are rejected)
+    /// @version    2026-10-16/GGB - Function created.
+
+    template<typename... Ts>
+      requires (requires(sqlCompiledStatement &statement, Ts &&value) { statement.bind(0, std::forward<Ts>(value)); } && ...)
+    sqlCompiledStatement &bindRow(Ts &&... values)
+    {
+      RUNTIME_ASSERT(sizeof...(Ts) == slotTypes.size(), "Number of values does not match the number of placeholders.");
+
+      std::size_t index = 0;
+      (bind(index++, std::forward<Ts>(values)), ...);
+
+      return *this;
+    }
+
+  private:
+    std::string sqlText;                            ///< Final text of the statement. Never changed after construction.
+    std::vector<parameterType_t> slotTypes;         ///< Placeholder types in text order. Never changed after construction.
+    std::vector<slotValue_t> slotValues;            ///< Bound values. Same size as slotTypes.
+
+    sqlCompiledStatement() = delete;
+  };
+
+} // namespace GCL
+
+#endif // GCL_SQLCOMPILEDSTATEMENT_H
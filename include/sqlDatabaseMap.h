@@ -0,0 +1,113 @@
+//*********************************************************************************************************************************
+//
+// PROJECT:             General Class Library
+// FILE:                sqlDatabaseMap.h
+// SUBSYSTEM:           Database library
+// LANGUAGE:            C++20
+// TARGET OS:           None - Standard C++
+// NAMESPACE:           GCL
+// AUTHOR:              Gavin Blakeman.
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the General Class Library (GCL)
+//
+//                      GCL is free software: you can redistribute it and/or modify it under the terms of the GNU General
+//                      Public License as published by the Free Software Foundation, either version 2 of the License, or
+//                      (at your option) any later version.
+//
+//                      GCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+//                      implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//                      for more details.
+//
+//                      You should have received a copy of the GNU General Public License along with GCL.  If not,
+//                      see <http://www.gnu.org/licenses/>.
+//
+// OVERVIEW:            An immutable snapshot of the table and column name mapping used by sqlWriter. The snapshot is shared
+//                      between sqlWriter instances.
+//
+// CLASSES INCLUDED:    sqlDatabaseMap
+//
+// HISTORY:             2026-10-16 GGB - File Created.
+//
+//*********************************************************************************************************************************
+
+#ifndef GCL_SQLDATABASEMAP_H
+#define GCL_SQLDATABASEMAP_H
+
+  // Standard C++ library header files
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace GCL
+{
+  /// @brief    The sqlDatabaseMap holds the mapping of table and column names to the names used in the database.
+  /// @details  The snapshot is immutable once constructed and is held by sqlWriter through a std::shared_ptr<sqlDatabaseMap const>.
+  ///           Copying a sqlWriter copies the pointer only. Changing the mapping creates a new snapshot.
+  ///           The map is data only. sqlWriter renders table and column names as given.
+  ///           Each name is stored once, in the definition. The lookup indexes are open addressing hash tables of
+  ///           string_views into the definition, so lookups do not allocate.
+
+  class sqlDatabaseMap
+  {
+  public:
+    struct SColumnData
+    {
+      std::pair<std::string, std::string> columnName;           ///< ColumnName, MappedName
+      bool unique = false;
+    };
+    typedef std::map<std::string, SColumnData> TColumnMap;
+
+    struct STableData
+    {
+      std::pair<std::string, std::string> tableName;            ///< TableName, MappedName
+      TColumnMap columnData;
+    };
+    typedef std::map<std::string, STableData> TDatabaseMap;
+
+    sqlDatabaseMap() = default;
+    explicit sqlDatabaseMap(TDatabaseMap &&);
+    sqlDatabaseMap(sqlDatabaseMap const &) = delete;              ///< The indexes refer into the definition.
+    sqlDatabaseMap(sqlDatabaseMap &&) = delete;
+    sqlDatabaseMap &operator=(sqlDatabaseMap const &) = delete;
+    sqlDatabaseMap &operator=(sqlDatabaseMap &&) = delete;
+    ~sqlDatabaseMap() = default;
+
+    [[nodiscard]] TDatabaseMap const &definition() const noexcept { return definition_; }
+    [[nodiscard]] std::uint64_t serial() const noexcept { return serial_; }
+    [[nodiscard]] bool empty() const noexcept { return definition_.empty(); }
+
+    [[nodiscard]] std::string_view tableName(std::string_view) const noexcept;
+    [[nodiscard]] std::string_view columnName(std::string_view, std::string_view) const noexcept;
+    [[nodiscard]] std::string_view columnName(std::string_view) const noexcept;
+
+  private:
+    struct entry_t
+    {
+      std::uint64_t hash = 0;
+      std::string_view table;
+      std::string_view column;
+      std::string_view mapped;      ///< Empty if the slot is not used.
+    };
+    using index_t = std::vector<entry_t>;
+
+    TDatabaseMap definition_;
+    std::uint64_t serial_ = 0;      ///< Unique for each snapshot. Used in the statement cache key.
+    index_t tables_;                ///< Table -> Mapped table.
+    index_t columns_;               ///< (Table, Column) -> Mapped column.
+    index_t unqualified_;           ///< Column -> Mapped column, for columns that map the same way in every table.
+
+    static std::uint64_t hash(std::string_view, std::string_view) noexcept;
+    static void reserve(index_t &, std::size_t);
+    static void insert(index_t &, entry_t const &) noexcept;
+    static entry_t const *find(index_t const &, std::string_view, std::string_view) noexcept;
+  };
+
+} // namespace GCL
+
+#endif // GCL_SQLDATABASEMAP_H
@@ -0,0 +1,84 @@
+﻿//*********************************************************************************************************************************
+//
+// PROJECT:             General Class Library
+// FILE:                sqlLiteral.h
+// SUBSYSTEM:           Database library
+// LANGUAGE:            C++20
+// TARGET OS:           None - Standard C++
+// NAMESPACE:           GCL
+// AUTHOR:              Gavin Blakeman.
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the General Class Library (GCL)
+//
+//                      GCL is free software: you can redistribute it and/or modify it under the terms of the GNU General
+//                      Public License as published by the Free Software Foundation, either version 2 of the License, or
+//                      (at your option) any later version.
+//
+//                      GCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+//                      implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//                      for more details.
+//
+//                      You should have received a copy of the GNU General Public License along with GCL.  If not,
+//                      see <http://www.gnu.org/licenses/>.
+//
+// OVERVIEW:            Functions to write SQL literal values directly into an output buffer. The functions do not use the
+//                      locale, do not convert through std::tm and do not allocate other than growing the output buffer.
+//
+// CLASSES INCLUDED:    None
+//
+// HISTORY:             2026-10-16 GGB - Added appendStringLiteral().
+//                      2026-10-16 GGB - File Created.
+//
+//*********************************************************************************************************************************
+
+#ifndef GCL_SQLLITERAL_H
+#define GCL_SQLLITERAL_H
+
+  // Standard C++ library header files
+
+#include <charconv>
+#include <chrono>
+#include <concepts>
+#include <string>
+#include <string_view>
+
+namespace GCL
+{
+  using timePoint_t = std::chrono::time_point<std::chrono::system_clock>;
+
+  /// @brief The quoting rules used for string literals.
+
+  enum EStringLiteral
+  {
+    SL_STANDARD,      ///< 'text' with quotes doubled. (Oracle, Microsoft)
+    SL_POSTGRE,       ///< As SL_STANDARD. If the text contains a backslash, E'text' with the backslashes doubled.
+    SL_MYSQL,         ///< 'text' with backslash escapes. (As mysql_real_escape_string())
+  };
+
+  /// @brief      Appends a number. Integers are written exactly. Floating point values are written in the shortest form that
+  ///             reads back to the same value. (1.5, not 1.500000)
+  /// @param[out] buffer: The buffer to append to.
+  /// @param[in]  value: The value to write.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-16/GGB - Function created.
+
+  template<typename T>
+    requires std::integral<T> || std::floating_point<T>
+  inline void appendLiteral(std::string &buffer, T value)
+  {
+    char text[32];
+    auto const [end, ec] = std::to_chars(text, text + sizeof(text), value);
+
+    buffer.append(text, end);
+  }
+
+  void appendStringLiteral(std::string &, std::string_view, EStringLiteral);
+  void appendDateLiteral(std::string &, timePoint_t);
+  void appendTimeLiteral(std::string &, timePoint_t);
+  void appendDateTimeLiteral(std::string &, timePoint_t);
+
+} // namespace GCL
+
+#endif // GCL_SQLLITERAL_H
@@ -0,0 +1,82 @@
+//*********************************************************************************************************************************
+//
+// PROJECT:             General Class Library
+// FILE:                sqlSerialiser.h
+// SUBSYSTEM:           Database library
+// LANGUAGE:            C++20
+// TARGET OS:           None - Standard C++
+// NAMESPACE:           GCL
+// AUTHOR:              Gavin Blakeman.
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the General Class Library (GCL)
+//
+//                      GCL is free software: you can redistribute it and/or modify it under the terms of the GNU General
+//                      Public License as published by the Free Software Foundation, either version 2 of the License, or
+//                      (at your option) any later version.
+//
+//                      GCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+//                      implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//                      for more details.
+//
+//                      You should have received a copy of the GNU General Public License along with GCL.  If not,
+//                      see <http://www.gnu.org/licenses/>.
+//
+// OVERVIEW:            Compact binary serialisation of a sqlWriter query. A query can be built once, stored or sent to another
+//                      process, and restored without re-running the builder calls.
+//
+// CLASSES INCLUDED:    sqlSerialiser
+//
+// HISTORY:             2026-10-16 GGB - File Created.
+//
+//*********************************************************************************************************************************
+
+#ifndef GCL_SQLSERIALISER_H
+#define GCL_SQLSERIALISER_H
+
+  // Standard C++ library header files
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+  // GCL Library header files
+
+#include "include/SQLWriter.h"
+
+namespace GCL
+{
+  /// @brief    The sqlSerialiser writes the complete state of a sqlWriter to a byte string and restores it.
+  /// @details  The format is a 4 byte magic ("GSQW"), a version byte and the query. Each query has a fixed settings block
+  ///           (dialect, IN list strategy, arena size, query type and flags) and a presence mask. Only the parts of the query
+  ///           that are set follow the mask. Integers are LEB128 varints (signed values are zig-zag encoded), floating
+  ///           point values are 4 or 8 little endian bytes, and strings are a varint length and the bytes. Values carry
+  ///           the variant index as a tag. Where clauses and sub-queries are written recursively.
+  ///           The reader does not copy the buffer. Strings are read as string_views into the buffer, and are copied once
+  ///           into the restored query. Fixed decimals are parsed in place.
+  ///           Not serialised:
+  ///             The database map. It is shared runtime state. (See sqlWriter::databaseMap())
+  ///             Column-wise insert values. The spans refer to the callers data, so they are written as rows of values.
+  /// @note     The buffer is not portable between builds with and without a 128 bit fixed decimal mantissa if a value
+  ///           has more than 18 digits.
+
+  class sqlSerialiser
+  {
+  public:
+    static constexpr std::uint8_t VERSION = 1;
+    static constexpr std::size_t MAX_DEPTH = 256;     ///< Maximum nesting of sub-queries and where clauses when reading.
+
+    static void serialise(std::string &, sqlWriter const &);
+    [[nodiscard]] static std::string serialise(sqlWriter const &);
+    [[nodiscard]] static sqlWriter deserialise(std::string_view);
+
+  private:
+    class writer;
+    class reader;
+  };
+
+} // namespace GCL
+
+#endif // GCL_SQLSERIALISER_H
@@ -0,0 +1,108 @@
+//*********************************************************************************************************************************
+//
+// PROJECT:             General Class Library
+// FILE:                sqlStatementCache.h
+// SUBSYSTEM:           Database library
+// LANGUAGE:            C++20
+// TARGET OS:           None - Standard C++
+// NAMESPACE:           GCL
+// AUTHOR:              Gavin Blakeman.
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the General Class Library (GCL)
+//
+//                      GCL is free software: you can redistribute it and/or modify it under the terms of the GNU General
+//                      Public License as published by the Free Software Foundation, either version 2 of the License, or
+//                      (at your option) any later version.
+//
+//                      GCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+//                      implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//                      for more details.
+//
+//                      You should have received a copy of the GNU General Public License along with GCL.  If not,
+//                      see <http://www.gnu.org/licenses/>.
+//
+// OVERVIEW:            A bounded, thread-safe, least recently used cache of rendered SQL statements. The cache is keyed by the
+//                      structural (shape) hash of a sqlWriter query.
+//
+// CLASSES INCLUDED:    sqlStatementCache
+//
+// HISTORY:             2026-10-16 GGB - File Created.
+//
+//*********************************************************************************************************************************
+
+#ifndef GCL_SQLSTATEMENTCACHE_H
+#define GCL_SQLSTATEMENTCACHE_H
+
+  // Standard C++ library header files
+
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+namespace GCL
+{
+  /// @brief    The sqlStatementCache stores the rendered text of prepared statements. Queries that have the same shape (tables,
+  ///           columns, operators, dialect and value arity) render to the same text, so the text can be re-used without walking the
+  ///           query tree again.
+  /// @details  The cache is disabled (capacity == 0) by default. Once the capacity is reached, the least recently used statement
+  ///           is evicted. All functions are thread-safe.
+
+  class sqlStatementCache
+  {
+  public:
+    using key_t = std::uint64_t;
+
+    struct statistics_t
+    {
+      std::uint64_t hits;
+      std::uint64_t misses;
+      std::uint64_t evictions;
+      std::size_t size;
+      std::size_t capacity;
+    };
+
+    sqlStatementCache(std::size_t = 0);
+    ~sqlStatementCache() = default;
+
+    [[nodiscard]] bool enabled() const noexcept { return capacity_.load(std::memory_order_relaxed) != 0; }
+    [[nodiscard]] std::size_t capacity() const noexcept { return capacity_.load(std::memory_order_relaxed); }
+    void capacity(std::size_t);
+
+    bool lookup(key_t, std::string &);
+    void insert(key_t, std::string_view);
+    void clear();
+
+    [[nodiscard]] statistics_t statistics() const;
+    void resetStatistics() noexcept;
+
+  private:
+    sqlStatementCache(sqlStatementCache const &) = delete;
+    sqlStatementCache(sqlStatementCache &&) = delete;
+    sqlStatementCache &operator=(sqlStatementCache const &) = delete;
+    sqlStatementCache &operator=(sqlStatementCache &&) = delete;
+
+    using entry_t = std::pair<key_t, std::string>;
+    using lruList_t = std::list<entry_t>;
+    using cacheIndex_t = std::unordered_map<key_t, lruList_t::iterator>;
+
+    mutable std::mutex cacheMutex;
+    lruList_t lruList;                            ///< Most recently used at the front.
+    cacheIndex_t cacheIndex;
+    std::atomic<std::size_t> capacity_;
+    std::atomic<std::uint64_t> hits_ = 0;
+    std::atomic<std::uint64_t> misses_ = 0;
+    std::atomic<std::uint64_t> evictions_ = 0;
+
+    void trim();
+  };
+
+} // namespace GCL
+
+#endif // GCL_SQLSTATEMENTCACHE_H
@@ -0,0 +1,560 @@
+﻿//*********************************************************************************************************************************
+//
+// PROJECT:             General Class Library
+// FILE:                sqlStaticStatement.h
+// SUBSYSTEM:           Database library
+// LANGUAGE:            C++20
+// TARGET OS:           None - Standard C++
+// NAMESPACE:           GCL
+// AUTHOR:              Gavin Blakeman.
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the General Class Library (GCL)
+//
+//                      GCL is free software: you can redistribute it and/or modify it under the terms of the GNU General
+//                      Public License as published by the Free Software Foundation, either version 2 of the License, or
+//                      (at your option) any later version.
+//
+//                      GCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+//                      implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//                      for more details.
+//
+//                      You should have received a copy of the GNU General Public License along with GCL.  If not,
+//                      see <http://www.gnu.org/licenses/>.
+//
+// OVERVIEW:            A constexpr builder for fixed prepared statements. The text of the statement and the types of the
+//                      placeholders are produced at compile time.
+//
+// CLASSES INCLUDED:    sqlStaticStatement
+//
+// HISTORY:             2026-10-16 GGB - File Created.
+//
+//*********************************************************************************************************************************
+
+#ifndef GCL_SQLSTATICSTATEMENT_H
+#define GCL_SQLSTATICSTATEMENT_H
+
+  // Standard C++ library header files
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+  // GCL Library header files
+
+#include "include/error.h"
+#include "include/SQLWriter.h"
+#include "include/sqlBindBuffer.h"
+#include "include/sqlCompiledStatement.h"
+
+namespace GCL
+{
+  /// @brief    The sqlStaticStatement builds a prepared statement from literal table and column names at compile time.
+  /// @details  The builder mirrors the fluent interface of sqlWriter. Each placeholder is declared with its parameterType_t.
+  ///           @code
+  ///           static constexpr sqlStaticStatement query = sqlStaticStatement(sqlWriter::MYSQL)
+  ///             .select({"ID", "NAME"}).from("TBL").where("ID", eq, sqlWriter::PT_I64).andWhere("NAME", neq, sqlWriter::PT_STRING);
+  ///
+  ///           bindStatic<query>(buffer, id, name);      // Checked against the placeholder types at compile time.
+  ///           @endcode
+  ///           The text has the same layout as the text rendered by a prepared sqlWriter, with every value a placeholder. Table and
+  ///           column names are used as written. (The table/column map is not applied.)
+  ///           Clauses must be added in SQL order. An error (clause out of order, capacity exceeded, unsupported operator) in a
+  ///           constant expression is a compile time error. At run time it throws GCL::runtime_error.
+
+  class sqlStaticStatement
+  {
+  public:
+    using parameterType_t = sqlWriter::parameterType_t;
+
+    static constexpr std::size_t maxLength = 1024;      ///< Capacity of the text. (bytes)
+    static constexpr std::size_t maxSlots = 64;         ///< Capacity of the placeholder list.
+
+    struct column_t
+    {
+      std::string_view name;
+      parameterType_t type;
+    };
+
+    constexpr explicit sqlStaticStatement(sqlWriter::EDialect dialect = sqlWriter::MYSQL) noexcept : dialect_(dialect) {}
+
+    /// @brief      Starts a SELECT statement.
+    /// @param[in]  columns: The columns to select.
+    /// @returns    (*this)
+    /// @version    2026-10-16/GGB - Function created.
+
+    constexpr sqlStaticStatement &select(std::initializer_list<std::string_view> columns)
+    {
+      start(CL_NONE, CL_SELECT);
+      append("SELECT ");
+      selectEnd_ = length_;
+      appendList(columns);
+      return *this;
+    }
+
+    /// @brief      Adds the FROM clause.
+    /// @param[in]  table: The table.
+    /// @returns    (*this)
+    /// @version    2026-10-16/GGB - Function created.
+
+    constexpr sqlStaticStatement &from(std::string_view table)
+    {
+      start(CL_SELECT, CL_FROM);
+      append(" FROM ");
+      append(table);
+      return *this;
+    }
+
+    /// @brief      Starts the WHERE clause with a test against a placeholder.
+    /// @param[in]  column: The column to test.
+    /// @param[in]  oper: The operator. BETWEEN has two placeholders. IN and NOT IN are not supported.
+    /// @param[in]  type: The type of the placeholder.
+    /// @returns    (*this)
+    /// @version    2026-10-16/GGB - Function created.
+
+    constexpr sqlStaticStatement &where(std::string_view column, operator_t oper, parameterType_t type)
+    {
+      if ((clause_ != CL_FROM) && (clause_ != CL_SET) && (clause_ != CL_DELETE))
+      {
+        RUNTIME_ERROR("sqlStaticStatement: WHERE must follow FROM, SET or DELETE.");
+      };
+      clause_ = CL_WHERE;
+      append(" WHERE ");
+      whereStart_ = length_;
+      appendTest(column, oper, type);
+      return *this;
+    }
+
+    constexpr sqlStaticStatement &andWhere(std::string_view column, operator_t oper, parameterType_t type)
+    {
+      return logical(" AND ", column, oper, type);
+    }
+
+    constexpr sqlStaticStatement &orWhere(std::string_view column, operator_t oper, parameterType_t type)
+    {
+      return logical(" OR ", column, oper, type);
+    }
+
+    /// @brief      Adds a column to the ORDER BY clause.
+    /// @param[in]  column: The column.
+    /// @param[in]  order: The sort order.
+    /// @returns    (*this)
+    /// @version    2026-10-16/GGB - Function created.
+
+    constexpr sqlStaticStatement &orderBy(std::string_view column, EOrderBy order = ASC)
+    {
+      if (clause_ == CL_ORDERBY)
+      {
+        append(", ");
+      }
+      else
+      {
+        if ((clause_ != CL_FROM) && (clause_ != CL_WHERE))
+        {
+          RUNTIME_ERROR("sqlStaticStatement: ORDER BY must follow FROM or WHERE.");
+        };
+        clause_ = CL_ORDERBY;
+        append(" ORDER BY ");
+      };
+      append(column);
+      append((order == DESC) ? " DESC " : " ASC ");
+      return *this;
+    }
+
+    /// @brief      Limits the number of rows returned. MICROSOFT uses TOP in the select clause.
+    /// @param[in]  rows: The maximum number of rows.
+    /// @returns    (*this)
+    /// @version    2026-10-16/GGB - Function created.
+
+    constexpr sqlStaticStatement &limit(std::uint64_t rows)
+    {
+      if ((clause_ != CL_FROM) && (clause_ != CL_WHERE) && (clause_ != CL_ORDERBY))
+      {
+        RUNTIME_ERROR("sqlStaticStatement: LIMIT must follow FROM, WHERE or ORDER BY.");
+      };
+      clause_ = CL_LIMIT;
+
+      switch (dialect_)
+      {
+        case sqlWriter::MYSQL:
+        {
+          append(" LIMIT ");
+          appendNumber(rows);
+          append(" ");
+          break;
+        }
+        case sqlWriter::POSTGRE:
+        {
+          append(" LIMIT ");
+          appendNumber(rows);
+          break;
+        }
+        case sqlWriter::ORACLE:
+        {
+          append(" FETCH FIRST ");
+          appendNumber(rows);
+          append(" ROWS ONLY");
+          break;
+        }
+        case sqlWriter::MICROSOFT:
+        {
+          std::size_t const tail = length_;
+
+          append("TOP ");
+          appendNumber(rows);
+          append(" ");
+          rotate(selectEnd_, tail);
+          break;
+        }
+      };
+      return *this;
+    }
+
+    /// @brief      Creates an INSERT statement with one row of placeholders.
+    /// @param[in]  table: The table.
+    /// @param[in]  columns: The columns and the types of their placeholders.
+    /// @returns    (*this)
+    /// @version    2026-10-16/GGB - Function created.
+
+    constexpr sqlStaticStatement &insertInto(std::string_view table, std::initializer_list<column_t> columns)
+    {
+      bool first = true;
+
+      start(CL_NONE, CL_INSERT);
+      append("INSERT INTO ");
+      append(table);
+      append(" (");
+      for (auto const &column : columns)
+      {
+        append(first ? "" : ", ");
+        append(column.name);
+        first = false;
+      };
+      append(")  VALUES (");
+      first = true;
+      for (auto const &column : columns)
+      {
+        append(first ? " ?" : ", ?");
+        addSlot(column.type);
+        first = false;
+      };
+      append(") ");
+      return *this;
+    }
+
+    /// @brief      Starts an UPDATE statement.
+    /// @param[in]  table: The table.
+    /// @returns    (*this)
+    /// @version    2026-10-16/GGB - Function created.
+
+    constexpr sqlStaticStatement &update(std::string_view table)
+    {
+      start(CL_NONE, CL_UPDATE);
+      append("UPDATE ");
+      append(table);
+      append(" ");
+      return *this;
+    }
+
+    /// @brief      Adds a column to the SET clause of an UPDATE statement.
+    /// @param[in]  column: The column.
+    /// @param[in]  type: The type of the placeholder.
+    /// @returns    (*this)
+    /// @version    2026-10-16/GGB - Function created.
+
+    constexpr sqlStaticStatement &set(std::string_view column, parameterType_t type)
+    {
+      if (clause_ == CL_SET)
+      {
+        append(", ");
+      }
+      else
+      {
+        start(CL_UPDATE, CL_SET);
+        append("SET ");
+      };
+      append(column);
+      append(" = ?");
+      addSlot(type);
+      return *this;
+    }
+
+    /// @brief      Starts a DELETE statement.
+    /// @param[in]  table: The table.
+    /// @returns    (*this)
+    /// @version    2026-10-16/GGB - Function created.
+
+    constexpr sqlStaticStatement &deleteFrom(std::string_view table)
+    {
+      start(CL_NONE, CL_DELETE);
+      append("DELETE FROM ");
+      append(table);
+      return *this;
+    }
+
+    [[nodiscard]] constexpr sqlWriter::EDialect dialect() const noexcept { return dialect_; }
+    [[nodiscard]] constexpr std::string_view sql() const noexcept { return std::string_view(text_.data(), length_); }
+    [[nodiscard]] constexpr std::size_t slotCount() const noexcept { return slotCount_; }
+
+    [[nodiscard]] constexpr parameterType_t slotType(std::size_t index) const
+    {
+      if (index >= slotCount_)
+      {
+        RUNTIME_ERROR("sqlStaticStatement: Placeholder index out of range.");
+      };
+      return slots_[index];
+    }
+
+    /// @brief      Returns the parameterType_t of a C++ type. Strings and string views are PT_STRING.
+    /// @returns    The parameter type. PT_NONE if the type cannot be bound.
+    /// @version    2026-10-16/GGB - Function created.
+
+    template<typename T>
+    static consteval parameterType_t typeOf() noexcept
+    {
+      using type = std::remove_cvref_t<T>;
+
+      if constexpr (std::is_same_v<type, std::uint8_t>) return sqlWriter::PT_U8;
+      else if constexpr (std::is_same_v<type, std::uint16_t>) return sqlWriter::PT_U16;
+      else if constexpr (std::is_same_v<type, std::uint32_t>) return sqlWriter::PT_U32;
+      else if constexpr (std::is_same_v<type, std::uint64_t>) return sqlWriter::PT_U64;
+      else if constexpr (std::is_same_v<type, std::int8_t>) return sqlWriter::PT_I8;
+      else if constexpr (std::is_same_v<type, std::int16_t>) return sqlWriter::PT_I16;
+      else if constexpr (std::is_same_v<type, std::int32_t>) return sqlWriter::PT_I32;
+      else if constexpr (std::is_same_v<type, std::int64_t>) return sqlWriter::PT_I64;
+      else if constexpr (std::is_same_v<type, float>) return sqlWriter::PT_FLOAT;
+      else if constexpr (std::is_same_v<type, double>) return sqlWriter::PT_DOUBLE;
+      else if constexpr (std::is_same_v<type, date_t>) return sqlWriter::PT_DATE;
+      else if constexpr (std::is_same_v<type, time_t>) return sqlWriter::PT_TIME;
+      else if constexpr (std::is_same_v<type, dateTime_t>) return sqlWriter::PT_DATETIME;
+      else if constexpr (std::is_same_v<type, decimal_t> || std::is_same_v<type, fixedDecimal_t>) return sqlWriter::PT_DECIMAL;
+      else if constexpr (std::is_convertible_v<type const &, std::string_view>) return sqlWriter::PT_STRING;
+      else return sqlWriter::PT_NONE;
+    }
+
+    /// @brief      Determines if a list of C++ types can be bound to the placeholders. There must be one type for each
+    ///             placeholder, of the same parameterType_t. A PT_NONE placeholder accepts any type that can be bound.
+    /// @returns    true if the types can be bound.
+    /// @version    2026-10-16/GGB - Function created.
+
+    template<typename... Ts>
+    [[nodiscard]] constexpr bool accepts() const noexcept
+    {
+      parameterType_t const types[] = { typeOf<Ts>()..., sqlWriter::PT_NONE };
+      bool returnValue = (sizeof...(Ts) == slotCount_);
+
+      for (std::size_t index = 0; returnValue && (index < sizeof...(Ts)); index++)
+      {
+        returnValue = (types[index] != sqlWriter::PT_NONE) &&
+                      ((slots_[index] == sqlWriter::PT_NONE) || (slots_[index] == types[index]));
+      };
+
+      return returnValue;
+    }
+
+    /// @brief      Creates a compiled statement with the text and placeholder types of the static statement.
+    /// @returns    The compiled statement.
+    /// @throws     std::bad_alloc
+    /// @version    2026-10-16/GGB - Function created.
+
+    [[nodiscard]] sqlCompiledStatement compile() const
+    {
+      return sqlCompiledStatement(std::string(sql()), std::vector<parameterType_t>(slots_.begin(), slots_.begin() + slotCount_));
+    }
+
+  private:
+    enum EClause
+    {
+      CL_NONE,
+      CL_SELECT,
+      CL_FROM,
+      CL_WHERE,
+      CL_ORDERBY,
+      CL_LIMIT,
+      CL_INSERT,
+      CL_UPDATE,
+      CL_SET,
+      CL_DELETE,
+    };
+
+    sqlWriter::EDialect dialect_;
+    EClause clause_ = CL_NONE;
+    std::array<char, maxLength> text_ = {};
+    std::size_t length_ = 0;
+    std::array<parameterType_t, maxSlots> slots_ = {};
+    std::size_t slotCount_ = 0;
+    std::size_t selectEnd_ = 0;           ///< End of "SELECT ". TOP is inserted here.
+    std::size_t whereStart_ = 0;          ///< Start of the where expression. Logical expressions are opened here.
+
+    constexpr void start(EClause expected, EClause next)
+    {
+      if (clause_ != expected)
+      {
+        RUNTIME_ERROR("sqlStaticStatement: Clause out of order.");
+      };
+      clause_ = next;
+    }
+
+    constexpr void append(std::string_view text)
+    {
+      if (length_ + text.size() > maxLength)
+      {
+        RUNTIME_ERROR("sqlStaticStatement: Statement too long.");
+      };
+      for (char c : text)
+      {
+        text_[length_++] = c;
+      };
+    }
+
+    constexpr void appendNumber(std::uint64_t value)
+    {
+      char digits[20] = {};
+      std::size_t count = 0;
+
+      do
+      {
+        digits[count++] = static_cast<char>('0' + value % 10);
+        value /= 10;
+      }
+      while (value != 0);
+
+      while (count != 0)
+      {
+        append(std::string_view(&digits[--count], 1));
+      };
+    }
+
+    constexpr void appendList(std::initializer_list<std::string_view> items)
+    {
+      bool first = true;
+
+      for (auto const &item : items)
+      {
+        append(first ? "" : ", ");
+        append(item);
+        first = false;
+      };
+    }
+
+    constexpr void addSlot(parameterType_t type)
+    {
+      if (slotCount_ == maxSlots)
+      {
+        RUNTIME_ERROR("sqlStaticStatement: Too many placeholders.");
+      };
+      slots_[slotCount_++] = type;
+    }
+
+      /* Appends a test in the same form as sqlWriter. (COLUMN op ?) */
+
+    constexpr void appendTest(std::string_view column, operator_t oper, parameterType_t type)
+    {
+      append("(");
+      append(column);
+      switch (oper)
+      {
+        case eq: append(" = ?"); break;
+        case gt: append(" > ?"); break;
+        case lt: append(" < ?"); break;
+        case gte: append(" >= ?"); break;
+        case lte: append(" <= ?"); break;
+        case neq: append(" != ?"); break;
+        case nse: append(" <=> ?"); break;
+        case between:
+        {
+          append(" BETWEEN ? AND ?");
+          addSlot(type);
+          break;
+        }
+        default:
+        {
+          RUNTIME_ERROR("sqlStaticStatement: Operator not supported.");
+        }
+      };
+      addSlot(type);
+      append(")");
+    }
+
+      /* Wraps the where expression and the new test in a logical expression. " (lhs AND rhs)" */
+
+    constexpr sqlStaticStatement &logical(std::string_view op, std::string_view column, operator_t oper, parameterType_t type)
+    {
+      if (clause_ != CL_WHERE)
+      {
+        RUNTIME_ERROR("sqlStaticStatement: AND/OR must follow WHERE.");
+      };
+
+      std::size_t const tail = length_;
+
+      append(" (");
+      rotate(whereStart_, tail);
+      append(op);
+      appendTest(column, oper, type);
+      append(")");
+      return *this;
+    }
+
+      /* Moves the text from tail to the end of the statement so that it starts at position. */
+
+    constexpr void rotate(std::size_t position, std::size_t tail)
+    {
+      while (tail != length_)
+      {
+        char const c = text_[tail];
+
+        for (std::size_t index = tail; index > position; index--)
+        {
+          text_[index] = text_[index - 1];
+        };
+        text_[position] = c;
+        position++;
+        tail++;
+      };
+    }
+  };
+
+  /// @brief      Binds a row of values for a static statement into a bind buffer. The number and types of the values are
+  ///             checked against the placeholders at compile time.
+  /// @tparam     statement: The static statement. Must have static storage duration.
+  /// @param[out] buffer: The bind buffer. The buffer is not cleared first.
+  /// @param[in]  values: The values, one for each placeholder.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-16/GGB - Function created.
+
+  template<sqlStaticStatement const &statement, typename... Ts>
+  void bindStatic(sqlBindBuffer &buffer, Ts const &... values)
+  {
+    static_assert(sizeof...(Ts) == statement.slotCount(), "Number of values does not match the number of placeholders.");
+    static_assert(statement.template accepts<Ts...>(), "Value types do not match the placeholder types.");
+
+    auto const push = [&buffer](auto const &value)
+    {
+      using type = std::remove_cvref_t<decltype(value)>;
+
+      if constexpr (sqlStaticStatement::typeOf<type>() == sqlWriter::PT_STRING)
+      {
+        buffer.push_back(std::string_view(value));
+      }
+      else if constexpr (std::is_same_v<type, std::int64_t> || std::is_same_v<type, double>)
+      {
+        buffer.push_back(value);
+      }
+      else
+      {
+        buffer.push_back(sqlWriter::parameter_t(value));
+      };
+    };
+
+    (push(values), ...);
+  }
+
+} // namespace GCL
+
+#endif // GCL_SQLSTATICSTATEMENT_H
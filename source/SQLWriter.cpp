@@ -30,7 +30,25 @@
 //
 // CLASSES INCLUDED:    sqWriter
 //
-// HISTORY:             2023-09-23 GGB - Extended to support parameterised queries.
+// HISTORY:             2026-10-16 GGB - insertStream() renders INSERT ALL for ORACLE.
+//                      2026-10-16 GGB - bindValues() adds the upsert values row by row.
+//                      2026-10-16 GGB - Added fingerprint(), fingerprint128() and normalisedText().
+//                      2026-10-16 GGB - Added multi-row upserts for all dialects. (upsert(table, {columns}), onConflict())
+//                      2026-10-16 GGB - Added keyset pagination. (seekAfter()) LIMIT/OFFSET for POSTGRE, ORACLE and MICROSOFT.
+//                      2026-10-16 GGB - Added strategies for long IN lists. (inList(), inListSetup())
+//                      2026-10-16 GGB - Added the optional per query arena for query tree nodes. (useArena())
+//                      2026-10-16 GGB - The table/column map is a shared immutable snapshot. (sqlDatabaseMap)
+//                      2026-10-16 GGB - String literals are quoted and escaped for the dialect.
+//                      2026-10-16 GGB - Literals are written with sqlLiteral.h. (No std::to_string, fmt or std::tm)
+//                      2026-10-16 GGB - Added fixedDecimal_t parameters. decimal_t is no longer copied by parameter_to_type.
+//                      2026-10-16 GGB - Added column-wise insert values. (values(columnStorage_t &&))
+//                      2026-10-16 GGB - Added bulk load output. (PostgreSQL COPY, MySQL LOAD DATA)
+//                      2026-10-16 GGB - Added insertStream() for chunked multi-row inserts.
+//                      2026-10-16 GGB - Added bindValues() for a contiguous bind buffer.
+//                      2026-10-16 GGB - Added compile() to produce a compiled statement with a fixed placeholder slot array.
+//                      2026-10-16 GGB - Added the rendered statement cache for prepared statements.
+//                      2026-10-16 GGB - Rendering writes into a single caller supplied buffer. (appendTo)
+//                      2023-09-23 GGB - Extended to support parameterised queries.
 //                      2023-03-28 GGB - Changed use of GCL::any to std::variant to better support parameterised queries.
 //                      2022-06-07 GGB - Expanded where clause functionality to support a broader range of statements
 //                      2022-05-01 GGB - Added support for "Returning"
@@ -48,7 +66,13 @@
   // Standard C++ library files
 
 #include <algorithm>
+#include <bit>
+#include <cctype>
+#include <charconv>
+#include <concepts>
+#include <cstring>
 #include <iostream>
+#include <limits>
 #include <fstream>
 #include <sstream>
 #include <typeinfo>
@@ -67,6 +91,9 @@
 #include "include/common.h"
 #include "include/error.h"
 #include "include/functionTrace.h"
+#include "include/sqlBindBuffer.h"
+#include "include/sqlCompiledStatement.h"
+#include "include/sqlLiteral.h"
 
 namespace GCL
 {
@@ -224,74 +251,339 @@ namespace GCL
    *
    */
 
+  /* Returns the string literal quoting rules for a dialect. */
+  static EStringLiteral stringLiteralStyle(sqlWriter::EDialect dialect) noexcept
+  {
+    switch (dialect)
+    {
+      case sqlWriter::MYSQL: return SL_MYSQL;
+      case sqlWriter::POSTGRE: return SL_POSTGRE;
+      default: return SL_STANDARD;
+    };
+  }
+
+  /* Determines if a list of parameters contains a bind value. */
+  template<typename C>
+  static bool containsBindValue(C const &pc) noexcept
+  {
+    return std::ranges::any_of(pc, [](sqlWriter::parameter_t const &p) { return std::holds_alternative<sqlWriter::bindValue_t>(p); });
+  }
+
   /* The struct below is used for converting the parameters to strings. This is needed for non-parameterised queries
-   * where the values need to be converted to strings.
+   * where the values need to be converted to strings. The string is appended directly to the output buffer.
    */
   struct parameter_to_string
   {
+    std::string &buffer;
     bool preparingClause; // Indicates that the statement is for a prepared statement.
+    EStringLiteral stringStyle = SL_STANDARD;
 
-    std::string operator()(std::uint8_t const &p) { return std::to_string(p); }
-    std::string operator()(std::uint16_t const &p) { return std::to_string(p); }
-    std::string operator()(std::uint32_t const &p) { return std::to_string(p); }
-    std::string operator()(std::uint64_t const &p) { return std::to_string(p); }
-    std::string operator()(std::int8_t const &p) { return std::to_string(p); }
-    std::string operator()(std::int16_t const &p) { return std::to_string(p); }
-    std::string operator()(std::int32_t const &p) { return std::to_string(p); }
-    std::string operator()(std::int64_t const &p) { return std::to_string(p); }
-    std::string operator()(float const &p) { return std::to_string(p); }
-    std::string operator()(double const &p) { return std::to_string(p); }
-    std::string operator()(date_t const p)
+    /* Dates and times are quoted unless preparing a clause. */
+    void quoted(void (*append)(std::string &, timePoint_t), timePoint_t tp)
     {
       if (preparingClause)
       {
-        return fmt::format("{:%Y-%m-%d}", fmt::gmtime(p.date()));
+        append(buffer, tp);
       }
       else
       {
-        return fmt::format("'{:%Y-%m-%d}'", fmt::gmtime(p.date()));
+        buffer += '\'';
+        append(buffer, tp);
+        buffer += '\'';
       };
     }
-    std::string operator()(time_t const p)
+
+    void operator()(std::uint8_t const &p) { appendLiteral(buffer, p); }
+    void operator()(std::uint16_t const &p) { appendLiteral(buffer, p); }
+    void operator()(std::uint32_t const &p) { appendLiteral(buffer, p); }
+    void operator()(std::uint64_t const &p) { appendLiteral(buffer, p); }
+    void operator()(std::int8_t const &p) { appendLiteral(buffer, p); }
+    void operator()(std::int16_t const &p) { appendLiteral(buffer, p); }
+    void operator()(std::int32_t const &p) { appendLiteral(buffer, p); }
+    void operator()(std::int64_t const &p) { appendLiteral(buffer, p); }
+    void operator()(float const &p) { appendLiteral(buffer, p); }
+    void operator()(double const &p) { appendLiteral(buffer, p); }
+    void operator()(date_t const &p) { quoted(appendDateLiteral, p.date()); }
+    void operator()(time_t const &p) { quoted(appendTimeLiteral, p.time()); }
+    void operator()(dateTime_t const &p) { quoted(appendDateTimeLiteral, p.dateTime()); }
+    void operator()(decimal_t const &p) { buffer += p.str(0, std::ios::fixed); }
+    void operator()(fixedDecimal_t const &p) { p.appendTo(buffer); }
+
+    void operator()(std::string const &s) { (*this)(std::string_view(s)); }
+    void operator()(std::string_view s)
     {
       if (preparingClause)
       {
-        return fmt::format("{:%H:%M:%S}", fmt::gmtime(p.time()));
+        buffer += '?';
       }
       else
       {
-        return fmt::format("'{:%H:%M:%S}'", fmt::gmtime(p.time()));
-      };
+        appendStringLiteral(buffer, s, stringStyle);
+      }
     }
-    std::string operator()(dateTime_t const p)
+    void operator()(sqlWriter::bindValue_t const &bvt)
     {
-      if (preparingClause)
+      bvt.appendTo(buffer);
+    }
+  };
+
+  /* Appends a PostgreSQL array literal. {1,2,"text"} Strings, dates and times are quoted with " and \ escaped. The list must
+   * not contain bind values.
+   */
+  template<typename C>
+  static void appendArrayLiteral(std::string &buffer, C const &pc)
+  {
+    parameter_to_string toString{buffer, true};
+    bool first = true;
+
+    buffer += '{';
+    for (auto const &p : pc)
+    {
+      if (first)
       {
-        return fmt::format("{:%Y-%m-%d %H:%M:%S}", fmt::gmtime(p.dateTime()));
+        first = false;
       }
       else
       {
-        return fmt::format("'{:%Y-%m-%d %H:%M:%S}'", fmt::gmtime(p.dateTime()));
+        buffer += ',';
       };
-    }
-    std::string operator()(decimal_t const p) { return p.str(0, std::ios::fixed); }
 
-    std::string operator()(std::string const &s)
-    {
-      using namespace std::string_literals;
-      if (preparingClause)
+      if (std::holds_alternative<std::string>(p))
       {
-      return "?";
+        buffer += '"';
+        for (char c : std::get<std::string>(p))
+        {
+          if ((c == '"') || (c == '\\'))
+          {
+            buffer += '\\';
+          };
+          buffer += c;
+        };
+        buffer += '"';
       }
-      else
+      else if (std::holds_alternative<date_t>(p) || std::holds_alternative<time_t>(p) || std::holds_alternative<dateTime_t>(p))
       {
-        return "'"s + s + "'"s;
+        buffer += '"';
+        std::visit(toString, p);
+        buffer += '"';
       }
+      else
+      {
+        std::visit(toString, p);
+      };
+    };
+    buffer += '}';
+  }
+
+  /* Escapes text for the PostgreSQL COPY text format or the MySQL LOAD DATA tab separated format. Runs of characters that do
+   * not need escaping are appended in one operation.
+   * The escape sets differ. \0 and \Z are MySQL only. (PostgreSQL reads \0 as an octal escape and \Z as Z) PostgreSQL text
+   * cannot contain NUL.
+   */
+  void appendBulkText(std::string &buffer, std::string_view text, bool mysql)
+  {
+    std::size_t runStart = 0;
+
+    for (std::size_t index = 0; index < text.size(); index++)
+    {
+      char escape = 0;
+
+      switch (text[index])
+      {
+        case '\\': escape = '\\'; break;
+        case '\t': escape = 't'; break;
+        case '\n': escape = 'n'; break;
+        case '\r': escape = 'r'; break;
+        case '\b': escape = mysql ? 0 : 'b'; break;
+        case '\f': escape = mysql ? 0 : 'f'; break;
+        case '\v': escape = mysql ? 0 : 'v'; break;
+        case '\0': escape = mysql ? '0' : 0; break;
+        case '\x1a': escape = mysql ? 'Z' : 0; break;
+        default: break;
+      };
+
+      if (escape != 0)
+      {
+        buffer.append(text.substr(runStart, index - runStart));
+        buffer += '\\';
+        buffer += escape;
+        runStart = index + 1;
+      };
+    };
+    buffer.append(text.substr(runStart));
+  }
+
+  /* Appends an integer in network (big endian) byte order. */
+  template<typename T>
+  void appendBigEndian(std::string &buffer, T value)
+  {
+    using unsigned_t = std::make_unsigned_t<T>;
+    unsigned_t const uv = static_cast<unsigned_t>(value);
+
+    for (int shift = (sizeof(T) - 1) * 8; shift >= 0; shift -= 8)
+    {
+      buffer += static_cast<char>((uv >> shift) & 0xFF);
+    };
+  }
+
+  /* Writes a parameter in the PostgreSQL COPY text format or the MySQL LOAD DATA format. */
+  struct parameter_to_bulkText
+  {
+    std::string &buffer;
+    bool mysql;
+
+    void operator()(std::uint8_t const &p) { appendLiteral(buffer, p); }
+    void operator()(std::uint16_t const &p) { appendLiteral(buffer, p); }
+    void operator()(std::uint32_t const &p) { appendLiteral(buffer, p); }
+    void operator()(std::uint64_t const &p) { appendLiteral(buffer, p); }
+    void operator()(std::int8_t const &p) { appendLiteral(buffer, p); }
+    void operator()(std::int16_t const &p) { appendLiteral(buffer, p); }
+    void operator()(std::int32_t const &p) { appendLiteral(buffer, p); }
+    void operator()(std::int64_t const &p) { appendLiteral(buffer, p); }
+    void operator()(float const &p) { appendLiteral(buffer, p); }
+    void operator()(double const &p) { appendLiteral(buffer, p); }
+    void operator()(date_t const &p) { appendDateLiteral(buffer, p.date()); }
+    void operator()(time_t const &p) { appendTimeLiteral(buffer, p.time()); }
+    void operator()(dateTime_t const &p) { appendDateTimeLiteral(buffer, p.dateTime()); }
+    void operator()(decimal_t const &p) { buffer += p.str(0, std::ios::fixed); }
+    void operator()(fixedDecimal_t const &p) { p.appendTo(buffer); }
+    void operator()(std::string const &p) { appendBulkText(buffer, p, mysql); }
+    void operator()(std::string_view p) { appendBulkText(buffer, p, mysql); }
+    void operator()(sqlWriter::bindValue_t const &) { buffer += "\\N"; }
+  };
+
+  /* Writes a parameter in the PostgreSQL COPY binary format. (Length prefixed, network byte order)
+   * PostgreSQL does not have unsigned or single byte integers. These are widened to the next larger signed type.
+   */
+  struct parameter_to_bulkBinary
+  {
+    std::string &buffer;
+
+    static constexpr std::int32_t POSTGRES_EPOCH_DAYS = 10957;                 // 1970-01-01 to 2000-01-01
+    static constexpr std::int64_t POSTGRES_EPOCH_US = 946684800000000;         // 1970-01-01 to 2000-01-01
+
+    template<typename T>
+    void field(T value)
+    {
+      appendBigEndian(buffer, static_cast<std::int32_t>(sizeof(T)));
+      appendBigEndian(buffer, value);
     }
-    std::string operator()(sqlWriter::bindValue_t const &bvt)
+
+    void operator()(std::uint8_t const &p) { field(static_cast<std::int16_t>(p)); }
+    void operator()(std::uint16_t const &p) { field(static_cast<std::int32_t>(p)); }
+    void operator()(std::uint32_t const &p) { field(static_cast<std::int64_t>(p)); }
+    void operator()(std::uint64_t const &p)
+    {
+      RUNTIME_ASSERT(p <= static_cast<std::uint64_t>(std::numeric_limits<std::int64_t>::max()),
+                     boost::locale::translate("Unsigned value too large for a PostgreSQL bigint."));
+      field(static_cast<std::int64_t>(p));
+    }
+    void operator()(std::int8_t const &p) { field(static_cast<std::int16_t>(p)); }
+    void operator()(std::int16_t const &p) { field(p); }
+    void operator()(std::int32_t const &p) { field(p); }
+    void operator()(std::int64_t const &p) { field(p); }
+    void operator()(float const &p) { field(std::bit_cast<std::int32_t>(p)); }
+    void operator()(double const &p) { field(std::bit_cast<std::int64_t>(p)); }
+    void operator()(date_t const &p)
+    {
+      auto const days = std::chrono::floor<std::chrono::days>(p.date()).time_since_epoch().count();
+      field(static_cast<std::int32_t>(days - POSTGRES_EPOCH_DAYS));
+    }
+    void operator()(time_t const &p)
+    {
+      auto const tp = p.time();
+      field(static_cast<std::int64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+                                        tp - std::chrono::floor<std::chrono::days>(tp)).count()));
+    }
+    void operator()(dateTime_t const &p)
+    {
+      auto const us = std::chrono::duration_cast<std::chrono::microseconds>(p.dateTime().time_since_epoch()).count();
+      field(static_cast<std::int64_t>(us - POSTGRES_EPOCH_US));
+    }
+    /* NUMERIC is sent as base 10000 digits. ndigits, weight, sign, dscale, digits...
+     * value = 0.digits * 10^point. The base 10000 digits are written straight into the buffer.
+     */
+    void numeric(bool negative, std::string_view digits, std::ptrdiff_t point, std::int16_t scale)
+    {
+      auto const group = [](std::ptrdiff_t place) { return (place >= 0) ? place / 4 : -((3 - place) / 4); };
+
+      while (!digits.empty() && (digits.front() == '0'))
+      {
+        digits.remove_prefix(1);
+        point--;
+      };
+      while (!digits.empty() && (digits.back() == '0'))
+      {
+        digits.remove_suffix(1);
+      };
+
+      std::ptrdiff_t const first = digits.empty() ? 0 : group(point - 1);
+      std::ptrdiff_t const last = digits.empty() ? 1 : group(point - static_cast<std::ptrdiff_t>(digits.size()));
+      std::ptrdiff_t const count = first - last + 1;
+
+      appendBigEndian(buffer, static_cast<std::int32_t>(8 + 2 * count));
+      appendBigEndian(buffer, static_cast<std::int16_t>(count));
+      appendBigEndian(buffer, static_cast<std::int16_t>(first));
+      appendBigEndian(buffer, static_cast<std::uint16_t>((negative && !digits.empty()) ? 0x4000 : 0x0000));
+      appendBigEndian(buffer, scale);
+
+      for (std::ptrdiff_t g = first; g >= last; g--)
+      {
+        std::int16_t value = 0;
+
+        for (std::ptrdiff_t place = 4 * g + 3; place >= 4 * g; place--)
+        {
+          std::ptrdiff_t const index = point - 1 - place;
+
+          value = value * 10 + (((index >= 0) && (index < static_cast<std::ptrdiff_t>(digits.size()))) ? (digits[index] - '0') : 0);
+        };
+        appendBigEndian(buffer, value);
+      };
+    }
+    void operator()(decimal_t const &p)
+    {
+      RUNTIME_ASSERT(boost::multiprecision::isfinite(p), boost::locale::translate("NUMERIC value must be finite."));
+
+      constexpr std::size_t DIGITS = std::numeric_limits<decimal_t>::digits10;
+      char text[DIGITS + 8];
+      mpfr_exp_t exponent;
+
+      mpfr_get_str(text, &exponent, 10, DIGITS, p.backend().data(), MPFR_RNDN);
+
+      bool const negative = (text[0] == '-');
+      std::string_view digits(text + (negative ? 1 : 0));
+
+      while (!digits.empty() && (digits.back() == '0'))
+      {
+        digits.remove_suffix(1);
+      };
+      numeric(negative, digits, exponent,
+              static_cast<std::int16_t>(std::max<std::ptrdiff_t>(0, static_cast<std::ptrdiff_t>(digits.size()) - exponent)));
+    }
+    void operator()(fixedDecimal_t const &p)
+    {
+      char text[fixedDecimal_t::MAX_CHARS + 256];
+      auto const [end, ec] = p.to_chars(text, text + sizeof(text));
+      bool const negative = (text[0] == '-');
+      char *begin = text + (negative ? 1 : 0);
+      char *point = std::find(begin, end, '.');
+      char *last = end;
+
+      if (point != end)
+      {
+        std::memmove(point, point + 1, static_cast<std::size_t>(end - point - 1));
+        last--;
+      };
+
+      numeric(negative, std::string_view(begin, static_cast<std::size_t>(last - begin)), point - begin, p.scale());
+    }
+    void operator()(std::string const &p) { (*this)(std::string_view(p)); }
+    void operator()(std::string_view p)
     {
-      return bvt.to_string();
+      appendBigEndian(buffer, static_cast<std::int32_t>(p.size()));
+      buffer += p;
     }
+    void operator()(sqlWriter::bindValue_t const &) { appendBigEndian(buffer, std::int32_t(-1)); }
   };
 
   /* Returns the type of the parameter. */
@@ -310,34 +602,40 @@ namespace GCL
     sqlWriter::parameterType_t operator()(date_t const ) { return sqlWriter::PT_DATE; }
     sqlWriter::parameterType_t operator()(time_t const ) { return sqlWriter::PT_TIME; }
     sqlWriter::parameterType_t operator()(dateTime_t const ) { return sqlWriter::PT_DATETIME; }
-    sqlWriter::parameterType_t operator()(decimal_t const ) { return sqlWriter::PT_DECIMAL; }
+    sqlWriter::parameterType_t operator()(decimal_t const &) { return sqlWriter::PT_DECIMAL; }
+    sqlWriter::parameterType_t operator()(fixedDecimal_t const &) { return sqlWriter::PT_DECIMAL; }
     sqlWriter::parameterType_t operator()(std::string const &) { return sqlWriter::PT_STRING; }
     sqlWriter::parameterType_t operator()(sqlWriter::bindValue_t const &) { CODE_ERROR(); }
   };
 
   struct selectExpression_to_string
   {
-    std::string operator()(std::uint8_t const &p) { return std::to_string(p); }
-    std::string operator()(std::uint16_t const &p) { return std::to_string(p); }
-    std::string operator()(std::uint32_t const &p) { return std::to_string(p); }
-    std::string operator()(std::uint64_t const &p) { return std::to_string(p); }
-    std::string operator()(std::int8_t const &p) { return std::to_string(p); }
-    std::string operator()(std::int16_t const &p) { return std::to_string(p); }
-    std::string operator()(std::int32_t const &p) { return std::to_string(p); }
-    std::string operator()(std::int64_t const &p) { return std::to_string(p); }
-    std::string operator()(float const &p) { return std::to_string(p); }
-    std::string operator()(double const &p) { return std::to_string(p); }
-    std::string operator()(date_t const p) { return fmt::format("'{:%Y-%m-%d}'", fmt::gmtime(p.date())); }
-    std::string operator()(time_t const p) { return fmt::format("'{:%H:%M:%S}'", fmt::gmtime(p.time())); }
-    std::string operator()(dateTime_t const p) { return fmt::format("'{:%Y-%m-%d %H:%M:%S}'", fmt::gmtime(p.dateTime())); }
-    std::string operator()(decimal_t const p) { return p.str(0, std::ios::fixed);; }
-    std::string operator()(std::string const &s) { return s; }
+    std::string &buffer;
+
+    void operator()(std::uint8_t const &p) { appendLiteral(buffer, p); }
+    void operator()(std::uint16_t const &p) { appendLiteral(buffer, p); }
+    void operator()(std::uint32_t const &p) { appendLiteral(buffer, p); }
+    void operator()(std::uint64_t const &p) { appendLiteral(buffer, p); }
+    void operator()(std::int8_t const &p) { appendLiteral(buffer, p); }
+    void operator()(std::int16_t const &p) { appendLiteral(buffer, p); }
+    void operator()(std::int32_t const &p) { appendLiteral(buffer, p); }
+    void operator()(std::int64_t const &p) { appendLiteral(buffer, p); }
+    void operator()(float const &p) { appendLiteral(buffer, p); }
+    void operator()(double const &p) { appendLiteral(buffer, p); }
+    void operator()(date_t const &p) { parameter_to_string{buffer, false}(p); }
+    void operator()(time_t const &p) { parameter_to_string{buffer, false}(p); }
+    void operator()(dateTime_t const &p) { parameter_to_string{buffer, false}(p); }
+    void operator()(decimal_t const &p) { buffer += p.str(0, std::ios::fixed); }
+    void operator()(fixedDecimal_t const &p) { p.appendTo(buffer); }
+    void operator()(std::string const &s) { buffer += s; }
   };
 
   struct groupBy_to_string
   {
-    std::string operator()(std::string const &s) { return s; }
-    std::string operator()(std::size_t const &cn) { return std::to_string(cn); }
+    std::string &buffer;
+
+    void operator()(std::string const &s) { buffer += s; }
+    void operator()(std::size_t const &cn) { buffer += std::to_string(cn); }
   };
 
   // helper type for the visitor
@@ -345,339 +643,1284 @@ namespace GCL
   // explicit deduction guide (not needed as of C++20)
   template<class... Ts> overloaded(Ts...) -> overloaded<Ts...>;
 
-  /// @brief      Gets all the parameters. These are returned as a queue of reference wrappers.
-  /// @details    This function needs to return all the parameters. This includes the parameters from where clauses, insert clauses
-  ///             and update clauses.
-  ///             Insert queries will generally not have where clauses.
-  ///             Select & Delete queries will generally only have where clause parameters.
-  ///             Update queries will have value and where clause parameters.
-  ///             The order of parameter return matches the order of parameters in the query, so values, folowed by where.
-  /// @param[out] params: The list to store the parameters in.
-  /// @throws
-  /// @version    2024-02-18/GGB - Function created.
+  /* The functions below are used to build the structural (shape) hash of a query. The hash must change whenever the rendered
+   * text would change. Values that are rendered inline are therefore included, while values that are rendered as placeholders
+   * are not.
+   */
 
-  void sqlWriter::bindValues(std::list<bindParameter_t> &params)
+  inline std::uint64_t hashMix(std::uint64_t x) noexcept
   {
-    switch (queryType)
-    {
-      case qt_update:
-      case qt_upsert:
-      {
-          // Work through the set fields and if a string, add it to the parameter list.
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ull;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebull;
+    x ^= x >> 31;
+    return x;
+  }
 
-        for (auto &parameter: setFields)
-        {
-          if (std::holds_alternative<std::string>(parameter.second))
-          {
-            params.push_back(std::ref(parameter.second));
-          }
-        }
-        [[fallthrough]];
-      }
-      case qt_select:
-      case qt_delete:
-      {
+  inline void hashCombine(std::uint64_t &seed, std::uint64_t value) noexcept
+  {
+    seed = hashMix(seed ^ (value + 0x9e3779b97f4a7c15ull));
+  }
 
-        if (!std::holds_alternative<std::monostate>(whereClause_.base))
-        {
-          std::visit(overloaded
-          {
-            [&](std::monostate &) { CODE_ERROR(); },
-            [&](whereTest_t &wt) { to_parameter(wt, params); },
-            [&](whereLogical_t &wl) { to_parameter(wl, params); },
-          }, whereClause_.base);
+  inline void hashCombine(std::uint64_t &seed, std::string_view value) noexcept
+  {
+    hashCombine(seed, value.size());
+    hashCombine(seed, std::hash<std::string_view>{}(value));
+  }
 
-        }
-        break;
-      }
-      case qt_insert:
-      {
-        std::visit(overloaded
-        {
-          [&](std::monostate &) { CODE_ERROR(); },
-          [&](valueStorage_t &vs) { to_parameter(vs, params); },
-          [&](pointer_t &pt) { /*pt->to_parameter();*/},
-        }, insertValue);
-        break;
-      }
-      case qt_call:
-      {
-        RUNTIME_ERROR("sqlWriter:: Requesting Parameters for call query.");
-        // Does not return.
-      }
-      case qt_none:
-      {
-        RUNTIME_ERROR("sqlWriter: Parameters requested, but no query defined.");
-        // Does not return.
-      }
-      default:
-      {
-        CODE_ERROR();
-        // Does not return.
-      }
-    }
+  template<std::integral T>
+  inline void hashValue(std::uint64_t &seed, T value) noexcept { hashCombine(seed, static_cast<std::uint64_t>(value)); }
+  inline void hashValue(std::uint64_t &seed, float value) noexcept { hashCombine(seed, std::bit_cast<std::uint32_t>(value)); }
+  inline void hashValue(std::uint64_t &seed, double value) noexcept { hashCombine(seed, std::bit_cast<std::uint64_t>(value)); }
+  inline void hashValue(std::uint64_t &seed, date_t const &value) { hashCombine(seed, value.date().time_since_epoch().count()); }
+  inline void hashValue(std::uint64_t &seed, time_t const &value) { hashCombine(seed, value.time().time_since_epoch().count()); }
+  inline void hashValue(std::uint64_t &seed, dateTime_t const &value)
+  {
+    hashCombine(seed, value.dateTime().time_since_epoch().count());
   }
+  inline void hashValue(std::uint64_t &seed, decimal_t const &value) { hashCombine(seed, value.str(0, std::ios::fixed)); }
+  inline void hashValue(std::uint64_t &seed, fixedDecimal_t const &value) noexcept
+  {
+    // The scale is part of the rendered text, so 1.5 and 1.50 hash differently.
 
-  std::string sqlWriter::to_string(parameter_t const &p) const
+    hashCombine(seed, static_cast<std::uint64_t>(value.mantissa()));
+    hashCombine(seed, static_cast<std::uint64_t>(value.mantissa() >> 32 >> 32));
+    hashCombine(seed, value.scale());
+  }
+  inline void hashValue(std::uint64_t &seed, std::string_view value) noexcept { hashCombine(seed, value); }
+  inline void hashValue(std::uint64_t &seed, std::string const &value) noexcept { hashCombine(seed, std::string_view(value)); }
+  inline void hashValue(std::uint64_t &seed, sqlWriter::bindValue_t const &value) noexcept
   {
-    parameter_to_string v{preparedStatement_};
-    return std::visit(v, p);
+    hashCombine(seed, std::string_view(value.name()));
   }
 
-  sqlWriter::parameterType_t sqlWriter::parameterType(parameter_t const &p)
+  /// @brief      Constructs a query that allocates its query tree nodes from an arena. (See useArena())
+  /// @param[in]  arenaSize: The initial size of the arena. (bytes)
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-16/GGB - Function created.
+
+  sqlWriter::sqlWriter(std::size_t arenaSize)
   {
-    return std::visit(parameter_to_type(), p);
+    useArena(arenaSize);
   }
 
-  sqlWriter::parameterType_t sqlWriter::parameterType(bindParameter_t const &bp)
+  /// @brief      Returns the process wide rendered statement cache. The cache is disabled until a capacity is set.
+  ///             @code sqlWriter::statementCache().capacity(500); @endcode
+  /// @returns    Reference to the statement cache.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
+
+  sqlStatementCache &sqlWriter::statementCache() noexcept
   {
-    FUNCTION_TRACE();
-//    sqlWriter::parameterType_t rv = PT_NONE;
-//
-//    std::visit(overloaded
-//    {
-//      [&](std::monostate const &) { CODE_ERROR(); },
-//      [&](parameter_ref const &pr) { rv = parameterType(pr.get()); },
-//      [&](parameterVariant_ref const &pvr) {  },
-//    }, bp);
-//
-//    return rv;
+    static sqlStatementCache cache;
+
+    return cache;
   }
 
-  std::string sqlWriter::to_string(groupBy_t const &p) const
+  /// @brief      Returns the shape key of the query. Queries with the same shape key render to the same SQL text.
+  ///             The serial number of the table/column map is included, so a changed map is not served from the cache.
+  /// @returns    The shape key.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - The map serial number is hashed here, not in hashShape().
+  /// @version    2026-10-16/GGB - Function created.
+
+  std::uint64_t sqlWriter::shapeKey() const
   {
-    return std::visit(groupBy_to_string(), p);
+    std::uint64_t seed = 0;
+
+    hashCombine(seed, databaseMap_ ? databaseMap_->serial() : 0);
+    hashShape(seed);
+
+    return seed;
   }
 
-  std::string sqlWriter::to_string(selectExpression_t const &p) const
+  /// @brief      Returns the fingerprint of the query. The fingerprint is a structural hash of the query tree: the query type,
+  ///             dialect, prepared flag, identifiers, operators and the number of values. Literal values are not included, so
+  ///             queries that only differ in their values have the same fingerprint. The query is not rendered.
+  /// @returns    The 64 bit fingerprint.
+  /// @throws     None.
+  /// @note       The fingerprint is stable within a build of the library. It is not stable between builds, as std::hash is
+  ///             used for the identifiers. It does not depend on the table/column map, so it is the same in every process.
+  /// @version    2026-10-16/GGB - The map serial number is not included.
+  /// @version    2026-10-16/GGB - Function created.
+
+  std::uint64_t sqlWriter::fingerprint() const
   {
-    return std::visit(selectExpression_to_string(), p);
+    std::uint64_t seed = 0;
+
+    hashShape(seed, false);
+
+    return seed;
   }
 
-  /// @brief      Converts a whereTest_t to a string.
-  /// @param[in]  w: The whereTest_t to convert.
-  /// @throws
-  /// @version    2022-06-07/GGB - Function created.
+  /// @brief      Returns a 128 bit fingerprint of the query. See fingerprint(). The two halves are computed from different seeds.
+  /// @returns    The fingerprint. (first is the same as fingerprint())
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
 
-  std::string sqlWriter::to_string(whereTest_t const &w) const
+  std::pair<std::uint64_t, std::uint64_t> sqlWriter::fingerprint128() const
   {
-    std::string returnValue = "(";
+    std::pair<std::uint64_t, std::uint64_t> returnValue = { 0, 0x6a09e667f3bcc909ull };
+
+    hashShape(returnValue.first, false);
+    hashShape(returnValue.second, false);
+
+    return returnValue;
+  }
 
-    returnValue += std::get<0>(w) + " ";
-    returnValue += operatorMap[std::get<1>(w)] + " ";
+  /* Copies SQL text, replacing string and numeric literals with '?'. Quoted identifiers, placeholders and names are copied
+   * unchanged. An E prefix on a POSTGRE string literal is removed with the literal.
+   */
+  static void normaliseLiterals(std::string &buffer, std::string_view text, bool backslashEscapes)
+  {
+    auto const isNameChar = [](char c) { return std::isalnum(static_cast<unsigned char>(c)) || (c == '_') || (c == '$'); };
+    std::size_t index = 0;
 
-    switch(std::get<1>(w))
+    while (index < text.size())
     {
-      case eq:
-      case gt:
-      case lt:
-      case gte:
-      case lte:
-      case neq:
-      case nse:
+      char const c = text[index];
+      bool const afterName = !buffer.empty() && isNameChar(buffer.back());
+
+      if (c == '\'')
       {
-        if (std::holds_alternative<parameter_t>(std::get<2>(w)))
+        bool escapes = backslashEscapes;
+
+        if ( (buffer.size() >= 1) && ((buffer.back() == 'E') || (buffer.back() == 'e')) &&
+             ((buffer.size() == 1) || !isNameChar(buffer[buffer.size() - 2])) )
         {
-          returnValue += to_string(std::get<parameter_t>(std::get<2>(w)));
-        }
-        else
+          buffer.pop_back();
+          escapes = true;
+        };
+
+        index++;
+        while (index < text.size())
         {
-          RUNTIME_ERROR("Only a single parameter is allowed for " + sqlWriter::operatorMap[std::get<1>(w)] + ".");
-        }
-        break;
+          if (escapes && (text[index] == '\\'))
+          {
+            index += 2;
+          }
+          else if ((text[index] == '\'') && (index + 1 < text.size()) && (text[index + 1] == '\''))
+          {
+            index += 2;
+          }
+          else if (text[index] == '\'')
+          {
+            break;
+          }
+          else
+          {
+            index++;
+          };
+        };
+        index++;
+        buffer += '?';
       }
-      case in:
-      case nin:
+      else if ((c == '"') || (c == '`'))
       {
-        returnValue += "(";
-        std::visit(overloaded
-         {
-           [&](parameter_t const &p) { returnValue += to_string(p) + ")"; },
-           [&](parameterVector_t const &pv)
-           {
-             bool first = true;
+        std::size_t const close = text.find(c, index + 1);
+        std::size_t const end = (close == std::string_view::npos) ? text.size() : close + 1;
 
-             for (auto const &p : pv)
-             {
-               if (first)
-               {
-                 first = false;
-               }
-               else
-               {
-                 returnValue += ", ";
-               }
-               returnValue += to_string(p);
-             }
-             returnValue += ")";
-           },
-           [&](parameterSet_t const &pv)
-           {
-             bool first = true;
+        buffer.append(text.substr(index, end - index));
+        index = end;
+      }
+      else if (std::isdigit(static_cast<unsigned char>(c)) && !afterName)
+      {
+        while ( (index < text.size()) &&
+                (std::isdigit(static_cast<unsigned char>(text[index])) || (text[index] == '.') ||
+                 (((text[index] == 'e') || (text[index] == 'E')) && (index + 1 < text.size()) &&
+                  (std::isdigit(static_cast<unsigned char>(text[index + 1])) || (text[index + 1] == '-') || (text[index + 1] == '+'))) ||
+                 (((text[index] == '-') || (text[index] == '+')) && ((text[index - 1] == 'e') || (text[index - 1] == 'E')))) )
+        {
+          index++;
+        };
+        buffer += '?';
+      }
+      else
+      {
+        buffer += c;
+        index++;
+      };
+    };
+  }
+
+  /// @brief      Returns the text of the query with the literal values replaced by placeholders. ('?') Queries with the same
+  ///             fingerprint have the same normalised text. Used to label caches and metrics by fingerprint.
+  /// @returns    The normalised text.
+  /// @throws     std::bad_alloc
+  /// @throws     GCL::CRuntimeError
+  /// @version    2026-10-16/GGB - Function created.
+
+  std::string sqlWriter::normalisedText() const
+  {
+    std::string text;
+    std::string returnValue;
+
+    appendTo(text);
+    returnValue.reserve(text.size());
+    normaliseLiterals(returnValue, text, dialect == MYSQL);
+
+    return returnValue;
+  }
+
+  /// @brief      Adds the shape of the query to the hash.
+  /// @details    All storage that is used when rendering the query is hashed. Values are only included when they are rendered
+  ///             inline. (IE not as placeholders)
+  /// @param[in,out] seed: The hash to update.
+  /// @param[in]  literals: false to exclude literal values. (Including LIMIT and OFFSET) The number of values is still hashed.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Added the literals parameter.
+  /// @version    2026-10-16/GGB - Function created.
+
+  void sqlWriter::hashShape(std::uint64_t &seed, bool literals) const
+  {
+    hashCombine(seed, queryType);
+    hashCombine(seed, dialect);
+    hashCombine(seed, preparedStatement_);
+
+    hashCombine(seed, selectFields.size());
+    for (auto const &field : selectFields)
+    {
+      hashCombine(seed, field.index());
+      std::visit([&](auto const &v) { hashValue(seed, v); }, field);
+    }
+
+    hashCombine(seed, returningFields_.size());
+    for (auto const &field : returningFields_)
+    {
+      hashCombine(seed, std::string_view(field));
+    }
+
+    hashCombine(seed, fromFields.size());
+    for (auto const &element : fromFields)
+    {
+      hashCombine(seed, std::get<0>(element).index());
+      std::visit(overloaded
+      {
+        [&](std::string const &p) { hashCombine(seed, std::string_view(p)); },
+        [&](pointer_t const &pt) { pt->hashShape(seed, literals); },
+      }, std::get<0>(element));
+
+      hashCombine(seed, std::get<1>(element).has_value());
+      if (std::get<1>(element))
+      {
+        hashCombine(seed, std::string_view(*std::get<1>(element)));
+      };
+    }
+
+    hashCombine(seed, std::string_view(insertTable));
+
+    if (!preparedStatement_)      // Prepared insert queries only render placeholders for the values.
+    {
+      hashCombine(seed, insertValue.index());
+      std::visit(overloaded
+      {
+        [&](std::monostate const &) { },
+        [&](valueStorage_t const &vs)
+        {
+          hashCombine(seed, vs.size());
+          for (auto const &row : vs)
+          {
+            hashCombine(seed, row.size());
+            for (auto const &value : row)
+            {
+              hashShape(seed, value, literals);
+            }
+          }
+        },
+        [&](pointer_t const &pt) { pt->hashShape(seed, literals); },
+        [&](columnStorage_t const &cs)
+        {
+          hashCombine(seed, cs.size());
+          for (auto const &column : cs)
+          {
+            hashCombine(seed, column.index());
+            std::visit([&](auto const &span)
+            {
+              hashCombine(seed, span.size());
+              for (auto const &value : span)
+              {
+                if (literals)
+                {
+                  hashValue(seed, value);
+                };
+              }
+            }, column);
+          }
+        },
+      }, insertValue);
+    }
+    else if ((queryType == qt_upsert) && std::holds_alternative<valueStorage_t>(insertValue))
+    {
+      hashCombine(seed, std::get<valueStorage_t>(insertValue).size());    // Prepared upserts render a placeholder row per row.
+    }
+
+    hashCombine(seed, conflictKeys_.size());
+    for (auto const &key : conflictKeys_)
+    {
+      hashCombine(seed, std::string_view(key));
+    }
+
+    hashCombine(seed, groupByFields_.size());
+    for (auto const &column : groupByFields_)
+    {
+      hashCombine(seed, column.index());
+      std::visit([&](auto const &v) { hashValue(seed, v); }, column);
+    }
+
+    hashCombine(seed, orderByFields.size());
+    for (auto const &element : orderByFields)
+    {
+      hashCombine(seed, std::string_view(element.first));
+      hashCombine(seed, element.second);
+    }
+
+    hashCombine(seed, joinFields.size());
+    for (auto const &element : joinFields)
+    {
+      hashCombine(seed, std::string_view(std::get<0>(element)));
+      hashCombine(seed, std::string_view(std::get<1>(element)));
+      hashCombine(seed, std::get<2>(element));
+      hashCombine(seed, std::string_view(std::get<3>(element).tableDefinition()));
+      hashCombine(seed, std::string_view(std::get<4>(element)));
+    }
+
+    hashCombine(seed, offsetValue.has_value());
+    hashCombine(seed, literals ? offsetValue.value_or(0) : 0);
+    hashCombine(seed, limitValue.has_value());
+    hashCombine(seed, literals ? limitValue.value_or(0) : 0);
+    hashCombine(seed, seekKeys_.size());
+    for (auto const &key : seekKeys_)
+    {
+      if (!preparedStatement_ || std::holds_alternative<bindValue_t>(key))    // Prepared keys are placeholders.
+      {
+        hashShape(seed, key, literals);
+      };
+    };
+
+    hashCombine(seed, countValue.has_value());
+    if (countValue)
+    {
+      hashCombine(seed, std::string_view((*countValue).first));
+      hashCombine(seed, std::string_view((*countValue).second));
+    };
+
+    hashCombine(seed, distinct_);
+
+    for (auto const *fields : { &minFields, &maxFields })
+    {
+      hashCombine(seed, fields->size());
+      for (auto const &element : *fields)
+      {
+        hashCombine(seed, std::string_view(element.first));
+        hashCombine(seed, std::string_view(element.second));
+      }
+    }
+
+    hashCombine(seed, std::string_view(updateTable));
+    hashCombine(seed, setFields.size());
+    for (auto const &element : setFields)
+    {
+      hashCombine(seed, std::string_view(element.first));
+      if (!preparedStatement_)    // Prepared set clauses only render placeholders.
+      {
+        hashShape(seed, element.second, literals);
+      }
+    }
+
+    hashCombine(seed, std::string_view(deleteTable));
+    hashCombine(seed, std::string_view(procedureName_));
+    hashCombine(seed, procedureParameters_.size());
+    for (auto const &param : procedureParameters_)
+    {
+      hashShape(seed, param, literals);
+    }
+
+    hashShape(seed, whereClause_, literals);
+
+    hashCombine(seed, forUpdate_);
+    hashCombine(seed, forShare_);
+  }
+
+  /// @brief      Adds the shape of a where clause to the hash.
+  /// @param[in,out] seed: The hash to update.
+  /// @param[in]  wv: The where clause.
+  /// @param[in]  literals: false to exclude literal values.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
+
+  void sqlWriter::hashShape(std::uint64_t &seed, whereVariant_t const &wv, bool literals) const
+  {
+    hashCombine(seed, wv.base.index());
+
+    std::visit(overloaded
+    {
+      [&](std::monostate const &) { },
+      [&](whereTest_t const &wt)
+      {
+        EInList const strategy = inListStrategy(wt);
+
+        hashCombine(seed, std::string_view(std::get<0>(wt)));
+        hashCombine(seed, std::get<1>(wt));
+        hashCombine(seed, std::get<2>(wt).index());
+        hashCombine(seed, strategy);
+        hashCombine(seed, (strategy == IN_CHUNKED) ? inListChunk_ : 0);
+
+        if ( (strategy == IN_TEMP_TABLE) || ((strategy == IN_ANY) && preparedStatement_) )
+        {
+            // The values are not in the text, so all lists have the same shape.
+        }
+        else
+        {
+          std::visit(overloaded
+          {
+            [&](parameter_t const &p) { hashShape(seed, p, literals); },
+            [&](parameterVector_t const &pv)
+            {
+              hashCombine(seed, pv.size());
+              for (auto const &p : pv)
+              {
+                hashShape(seed, p, literals);
+              }
+            },
+            [&](parameterSet_t const &pv)
+            {
+              hashCombine(seed, pv.size());
+              for (auto const &p : pv)
+              {
+                hashShape(seed, p, literals);
+              }
+            },
+            [&](pointer_t const &pt) { pt->hashShape(seed, literals); },
+          }, std::get<2>(wt));
+        };
+      },
+      [&](whereLogical_t const &wl)
+      {
+        hashShape(seed, *std::get<0>(wl), literals);
+        hashCombine(seed, std::get<1>(wl));
+        hashShape(seed, *std::get<2>(wl), literals);
+      },
+    }, wv.base);
+  }
+
+  /// @brief      Adds a parameter to the hash. The parameter is hashed to match the way that it is rendered by appendTo().
+  /// @param[in,out] seed: The hash to update.
+  /// @param[in]  p: The parameter.
+  /// @param[in]  literals: false to hash only the presence of a value. Named bind values are always hashed.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
+
+  void sqlWriter::hashShape(std::uint64_t &seed, parameter_t const &p, bool literals) const
+  {
+    if (!literals && !std::holds_alternative<bindValue_t>(p))
+    {
+      hashCombine(seed, 0x3f);    // '?'
+    }
+    else
+    {
+      hashCombine(seed, p.index());
+
+      if (!(preparedStatement_ && std::holds_alternative<std::string>(p)))   // Prepared strings are rendered as placeholders.
+      {
+        std::visit([&](auto const &v) { hashValue(seed, v); }, p);
+      };
+    };
+  }
+
+  /// @brief      Gets all the parameters. These are returned as a queue of reference wrappers.
+  /// @details    This function needs to return all the parameters. This includes the parameters from where clauses, insert clauses
+  ///             and update clauses.
+  ///             Insert queries will generally not have where clauses.
+  ///             Select & Delete queries will generally only have where clause parameters.
+  ///             Update queries will have value and where clause parameters.
+  ///             The order of parameter return matches the order of parameters in the query, so values, folowed by where.
+  /// @param[out] params: The list to store the parameters in.
+  /// @note       Upsert values are added one parameter per cell, row by row, as every dialect renders them by row.
+  /// @throws     GCL::runtime_error
+  /// @version    2026-10-16/GGB - Upsert values are added by row.
+  /// @version    2026-10-16/GGB - Adds the seek keys of select queries.
+  /// @version    2024-02-18/GGB - Function created.
+
+  void sqlWriter::bindValues(std::list<bindParameter_t> &params)
+  {
+    switch (queryType)
+    {
+      case qt_update:
+      case qt_upsert:
+      {
+        if (queryType == qt_upsert)
+        {
+          std::visit(overloaded
+          {
+            [&](std::monostate &) { },
+            [&](valueStorage_t &vs)
+            {
+              for (auto &row : vs)
+              {
+                for (auto &cell : row)
+                {
+                  params.push_back(std::ref(cell));
+                };
+              };
+            },
+            [&](pointer_t &) { },
+            [&](columnStorage_t &) { RUNTIME_ERROR("sqlWriter: Use bindValues(sqlBindBuffer &) for column-wise values."); },
+          }, insertValue);
+        };
+
+          // Work through the set fields and if a string, add it to the parameter list.
+
+        for (auto &parameter: setFields)
+        {
+          if (std::holds_alternative<std::string>(parameter.second))
+          {
+            params.push_back(std::ref(parameter.second));
+          }
+        }
+        [[fallthrough]];
+      }
+      case qt_select:
+      case qt_delete:
+      {
+
+        if (!std::holds_alternative<std::monostate>(whereClause_.base))
+        {
+          std::visit(overloaded
+          {
+            [&](std::monostate &) { CODE_ERROR(); },
+            [&](whereTest_t &wt) { to_parameter(wt, params); },
+            [&](whereLogical_t &wl) { to_parameter(wl, params); },
+          }, whereClause_.base);
+
+        }
+
+          // The seek keys are rendered once each for a row value, and as K1, K1 K2, K1 K2 K3... for the expanded form.
+
+        if ((queryType == qt_select) && !seekKeys_.empty())
+        {
+          for (std::size_t term = seekRowValue() ? seekKeys_.size() - 1 : 0; term < seekKeys_.size(); term++)
+          {
+            for (std::size_t index = 0; index <= term; index++)
+            {
+              parameter_t &key = seekKeys_[index];
+
+              if (preparedStatement_ || std::holds_alternative<bindValue_t>(key))
+              {
+                params.push_back(std::ref(key));
+              };
+            };
+          };
+        };
+        break;
+      }
+      case qt_insert:
+      {
+        std::visit(overloaded
+        {
+          [&](std::monostate &) { CODE_ERROR(); },
+          [&](valueStorage_t &vs) { to_parameter(vs, params); },
+          [&](pointer_t &pt) { /*pt->to_parameter();*/},
+          [&](columnStorage_t &) { RUNTIME_ERROR("sqlWriter: Use bindValues(sqlBindBuffer &) for column-wise values."); },
+        }, insertValue);
+        break;
+      }
+      case qt_call:
+      {
+        RUNTIME_ERROR("sqlWriter:: Requesting Parameters for call query.");
+        // Does not return.
+      }
+      case qt_none:
+      {
+        RUNTIME_ERROR("sqlWriter: Parameters requested, but no query defined.");
+        // Does not return.
+      }
+      default:
+      {
+        CODE_ERROR();
+        // Does not return.
+      }
+    }
+  }
+
+  /// @brief      Fills a bind buffer with the values of the placeholders. The values are added in the same order as the
+  ///             placeholders in the text returned by appendTo() and compile().
+  /// @param[out] bb: The bind buffer to fill. The buffer is not cleared first.
+  /// @throws     std::bad_alloc
+  /// @note       For prepared insert queries the values of every row are added. Row r, column c is at index
+  ///             r * columnCount() + c.
+  /// @note       Placeholders without values (bind values) are added as NULL.
+  /// @version    2026-10-16/GGB - Function created.
+
+  void sqlWriter::bindValues(sqlBindBuffer &bb) const
+  {
+    visitPlaceholders(overloaded
+    {
+      [&](parameter_t const *p)
+      {
+        if (p == nullptr)
+        {
+          bb.push_null();
+        }
+        else
+        {
+          bb.push_back(*p);
+        };
+      },
+      [&](std::int64_t const &v) { bb.push_back(v); },
+      [&](double const &v) { bb.push_back(v); },
+      [&](std::string_view const &v) { bb.push_back(v); },
+    });
+  }
+
+  /// @brief      Appends a parameter to the output buffer.
+  /// @param[out] buffer: The buffer to append to.
+  /// @param[in]  p: The parameter to append.
+  /// @version    2026-10-16/GGB - Changed to append to a buffer rather than returning a string.
+
+  void sqlWriter::appendTo(std::string &buffer, parameter_t const &p) const
+  {
+    std::visit(parameter_to_string{buffer, preparedStatement_, stringLiteralStyle(dialect)}, p);
+  }
+
+  /// @brief      Creates a decimal parameter from text. A fixedDecimal_t is used if the value fits, otherwise decimal_t.
+  /// @param[in]  text: The decimal number. [+|-]digits[.digits]
+  /// @returns    The parameter.
+  /// @throws     std::runtime_error (decimal_t parse errors)
+  /// @version    2026-10-16/GGB - Function created.
+
+  sqlWriter::parameter_t sqlWriter::makeDecimal(std::string_view text)
+  {
+    fixedDecimal_t value;
+
+    if (fixedDecimal_t::from_chars(text, value))
+    {
+      return parameter_t(value);
+    }
+    else
+    {
+      return parameter_t(decimal_t(std::string(text)));
+    };
+  }
+
+  sqlWriter::parameterType_t sqlWriter::parameterType(parameter_t const &p)
+  {
+    return std::visit(parameter_to_type(), p);
+  }
+
+  sqlWriter::parameterType_t sqlWriter::parameterType(bindParameter_t const &bp)
+  {
+    FUNCTION_TRACE();
+//    sqlWriter::parameterType_t rv = PT_NONE;
+//
+//    std::visit(overloaded
+//    {
+//      [&](std::monostate const &) { CODE_ERROR(); },
+//      [&](parameter_ref const &pr) { rv = parameterType(pr.get()); },
+//      [&](parameterVariant_ref const &pvr) {  },
+//    }, bp);
+//
+//    return rv;
+  }
 
-             for (auto const &p : pv)
-             {
-               if (first)
-               {
-                 first = false;
-               }
-               else
-               {
-                 returnValue += ", ";
-               }
-               returnValue += to_string(p);
-             }
-             returnValue += ")";
-           },
-           [&](pointer_t const &pt)
+  void sqlWriter::appendTo(std::string &buffer, groupBy_t const &p) const
+  {
+    std::visit(groupBy_to_string{buffer}, p);
+  }
+
+  void sqlWriter::appendTo(std::string &buffer, selectExpression_t const &p) const
+  {
+    std::visit(selectExpression_to_string{buffer}, p);
+  }
+
+  /// @brief      Appends a comma separated list of parameters to the output buffer.
+  /// @param[out] buffer: The buffer to append to.
+  /// @param[in]  pc: The parameter container. (vector or set)
+  /// @version    2026-10-16/GGB - Function created.
+
+  template<typename C>
+  void sqlWriter::appendList(std::string &buffer, C const &pc) const
+  {
+    bool first = true;
+
+    for (auto const &p : pc)
+    {
+      if (first)
+      {
+        first = false;
+      }
+      else
+      {
+        buffer += ", ";
+      }
+      appendTo(buffer, p);
+    }
+  }
+
+  /// @brief      Appends a whereTest_t to the output buffer.
+  /// @param[out] buffer: The buffer to append to.
+  /// @param[in]  w: The whereTest_t to convert.
+  /// @throws
+  /// @version    2026-10-16/GGB - Long IN lists are rendered by appendInList().
+  /// @version    2026-10-16/GGB - Changed to append to a buffer rather than returning a string.
+  /// @version    2022-06-07/GGB - Function created.
+
+  void sqlWriter::appendTo(std::string &buffer, whereTest_t const &w) const
+  {
+    EInList const strategy = inListStrategy(w);
+
+    if (strategy != IN_LIST)
+    {
+      std::visit(overloaded
+      {
+        [&](parameterVector_t const &pv) { appendInList(buffer, w, pv, strategy); },
+        [&](parameterSet_t const &ps) { appendInList(buffer, w, ps, strategy); },
+        [&](auto const &) { CODE_ERROR(); },
+      }, std::get<2>(w));
+    }
+    else
+    {
+      buffer += '(';
+      buffer += std::get<0>(w);
+      buffer += ' ';
+      buffer += operatorMap[std::get<1>(w)];
+      buffer += ' ';
+
+      switch(std::get<1>(w))
+      {
+        case eq:
+        case gt:
+        case lt:
+        case gte:
+        case lte:
+        case neq:
+        case nse:
+        {
+          if (std::holds_alternative<parameter_t>(std::get<2>(w)))
+          {
+            appendTo(buffer, std::get<parameter_t>(std::get<2>(w)));
+          }
+          else
+          {
+            RUNTIME_ERROR("Only a single parameter is allowed for " + sqlWriter::operatorMap[std::get<1>(w)] + ".");
+          }
+          break;
+        }
+        case in:
+        case nin:
+        {
+          buffer += '(';
+          std::visit(overloaded
            {
-             returnValue += static_cast<std::string>(*pt) + ")";
-           },
-         }, std::get<2>(w));
+             [&](parameter_t const &p) { appendTo(buffer, p); },
+             [&](parameterVector_t const &pv) { appendList(buffer, pv); },
+             [&](parameterSet_t const &pv) { appendList(buffer, pv); },
+             [&](pointer_t const &pt) { pt->appendTo(buffer); },
+           }, std::get<2>(w));
+          buffer += ')';
+          break;
+        };
+        case between:
+        {
+          if (std::holds_alternative<parameterVector_t>(std::get<2>(w)))
+          {
+            if (std::get<parameterVector_t>(std::get<2>(w)).size() != 2)
+            {
+              RUNTIME_ERROR("Two parameters are required for 'BETWEEN'.");
+            }
+            else
+            {
+              appendTo(buffer, std::get<parameterVector_t>(std::get<2>(w))[0]);
+              buffer += " AND ";
+              appendTo(buffer, std::get<parameterVector_t>(std::get<2>(w))[1]);
+            }
+          }
+          break;
+        }
+        default:
+        {
+          CODE_ERROR();
+          break;
+        }
+      }
+      buffer += ')';
+    };
+  }
+
+  /// @brief      Appends an IN/NOT IN test with a long list of values using the strategy for the list.
+  /// @param[out] buffer: The buffer to append to.
+  /// @param[in]  w: The where test.
+  /// @param[in]  pc: The values. (vector or set)
+  /// @param[in]  strategy: The strategy from inListStrategy().
+  /// @throws     GCL::CCodeError
+  /// @version    2026-10-16/GGB - Function created.
+
+  template<typename C>
+  void sqlWriter::appendInList(std::string &buffer, whereTest_t const &w, C const &pc, EInList strategy) const
+  {
+    std::string const &column = std::get<0>(w);
+    bool const notIn = (std::get<1>(w) == nin);
+
+    buffer += '(';
+    switch (strategy)
+    {
+      case IN_CHUNKED:
+      {
+          // NOT IN groups are joined with AND. (x NOT IN (a, b, c, d)) == ((x NOT IN (a, b)) AND (x NOT IN (c, d)))
+
+        auto iter = pc.begin();
+        std::size_t remaining = pc.size();
+
+        while (remaining != 0)
+        {
+          std::size_t const count = std::min(remaining, inListChunk_);
+
+          if (iter != pc.begin())
+          {
+            buffer += notIn ? " AND " : " OR ";
+          };
+          buffer += '(';
+          buffer += column;
+          buffer += ' ';
+          buffer += operatorMap[std::get<1>(w)];
+          buffer += " (";
+          for (std::size_t index = 0; index < count; index++, ++iter)
+          {
+            if (index != 0)
+            {
+              buffer += ", ";
+            };
+            appendTo(buffer, *iter);
+          };
+          buffer += "))";
+          remaining -= count;
+        };
         break;
       };
-      case between:
+      case IN_ANY:
+      {
+        buffer += column;
+        buffer += notIn ? " <> ALL(" : " = ANY(";
+        if (preparedStatement_)
+        {
+          buffer += '?';
+        }
+        else
+        {
+          std::string array;
+
+          appendArrayLiteral(array, pc);
+          appendStringLiteral(buffer, array, SL_POSTGRE);
+        };
+        buffer += ')';
+        break;
+      };
+      case IN_VALUES:
       {
-        if (std::holds_alternative<parameterVector_t>(std::get<2>(w)))
+          // MYSQL uses VALUES ROW(...) and names the column column_0.
+
+        bool first = true;
+
+        buffer += column;
+        buffer += ' ';
+        buffer += operatorMap[std::get<1>(w)];
+        buffer += (dialect == MYSQL) ? " (SELECT column_0 FROM (VALUES " : " (SELECT v FROM (VALUES ";
+        for (auto const &p : pc)
         {
-          if (std::get<parameterVector_t>(std::get<2>(w)).size() != 2)
+          if (first)
           {
-            RUNTIME_ERROR("Two parameters are required for 'BETWEEN'.");
+            first = false;
           }
           else
           {
-            returnValue += to_string(std::get<parameterVector_t>(std::get<2>(w))[0]);
-            returnValue += " AND ";
-            returnValue += to_string(std::get<parameterVector_t>(std::get<2>(w))[1]);
-          }
-        }
+            buffer += ", ";
+          };
+          buffer += (dialect == MYSQL) ? "ROW(" : "(";
+          appendTo(buffer, p);
+          buffer += ')';
+        };
+        buffer += (dialect == MYSQL) ? ") AS t)" : ") AS t(v))";
         break;
-      }
+      };
+      case IN_TEMP_TABLE:
+      {
+        buffer += column;
+        buffer += ' ';
+        buffer += operatorMap[std::get<1>(w)];
+        buffer += " (SELECT v FROM ";
+        buffer += inListTable(column);
+        buffer += ')';
+        break;
+      };
       default:
       {
         CODE_ERROR();
         break;
-      }
-    }
-    returnValue += ")";
-    return returnValue;
+      };
+    };
+    buffer += ')';
   }
 
-  /// @brief      Converts a whereTest_t to a string.
-  /// @param[in]  w: The whereTest_t to convert.
+  /// @brief      Appends a whereLogical_t to the output buffer.
+  /// @param[out] buffer: The buffer to append to.
+  /// @param[in]  wl: The whereLogical_t to convert.
   /// @throws
+  /// @version    2026-10-16/GGB - Changed to append to a buffer rather than returning a string.
   /// @version    2022-06-07/GGB - Function created.
 
-  std::string sqlWriter::to_string(whereLogical_t const &wl) const
+  void sqlWriter::appendTo(std::string &buffer, whereLogical_t const &wl) const
   {
-    std::string returnValue = " (";
-
-    returnValue += to_string(*std::get<0>(wl));
-    returnValue += " " + logicalOperatorMap[std::get<1>(wl)] + " ";
-    returnValue += to_string(*std::get<2>(wl)) + ")";
-
-    return returnValue;
+    buffer += " (";
+    appendTo(buffer, *std::get<0>(wl));
+    buffer += ' ';
+    buffer += logicalOperatorMap[std::get<1>(wl)];
+    buffer += ' ';
+    appendTo(buffer, *std::get<2>(wl));
+    buffer += ')';
   }
 
-  //  class whereVariant_t : public std::variant<whereTest_t, whereLogical_t, nullptr_t>
-  std::string sqlWriter::to_string(whereVariant_t const &wv) const
-  {
-    std::string returnValue;
+  /// @brief      Appends a whereVariant_t to the output buffer.
+  /// @param[out] buffer: The buffer to append to.
+  /// @param[in]  wv: The whereVariant_t to convert.
+  /// @throws
+  /// @version    2026-10-16/GGB - Changed to append to a buffer rather than returning a string.
 
+  void sqlWriter::appendTo(std::string &buffer, whereVariant_t const &wv) const
+  {
     std::visit(overloaded
                {
                  [&](std::monostate const &) { CODE_ERROR(); },
-                 [&](whereTest_t const &wt) { returnValue = to_string(wt); },
-                 [&](whereLogical_t const &wl) { returnValue = to_string(wl); },
+                 [&](whereTest_t const &wt) { appendTo(buffer, wt); },
+                 [&](whereLogical_t const &wl) { appendTo(buffer, wl); },
                }, wv.base);
+  }
+
+  /// @brief      Appends the values for an INSERT query to the output buffer.
+  /// @param[out] buffer: The buffer to append to.
+  /// @param[in]  values: The values to convert to a string.
+  /// @version    2026-10-16/GGB - Changed to append to a buffer rather than returning a string.
+  /// @version    2022-07-23/GGB - Function created.
+
+  void sqlWriter::appendTo(std::string &buffer, valueType_t const &values) const
+  {
+    std::visit(overloaded
+    {
+      [&](std::monostate const &) { CODE_ERROR(); },
+      [&](valueStorage_t const &vs) { appendTo(buffer, vs); },
+      [&](pointer_t const &pt)
+      {
+        buffer += "( ";
+        pt->appendTo(buffer);
+        buffer += ") ";
+      },
+      [&](columnStorage_t const &cs) { appendTo(buffer, cs); },
+    }, values);
+  }
+
+  /// @brief      Appends column-wise values for an INSERT query to the output buffer. The cells are read directly from the
+  ///             columns.
+  /// @param[out] buffer: The buffer to append to.
+  /// @param[in]  columns: The columns of values.
+  /// @throws     GCL::CRuntimeAssert
+  /// @version    2026-10-16/GGB - Function created.
+
+  void sqlWriter::appendTo(std::string &buffer, columnStorage_t const &columns) const
+  {
+    RUNTIME_ASSERT(!columns.empty(), boost::locale::translate("No columns defined for column-wise values."));
+
+    std::size_t const rows = columnLength(columns.front());
+    parameter_to_string cellToString{buffer, preparedStatement_, stringLiteralStyle(dialect)};
+
+    buffer += "VALUES ";
+
+    for (std::size_t row = 0; row < rows; row++)
+    {
+      if (row != 0)
+      {
+        buffer += ", ";
+      };
+
+      buffer += '(';
+      for (std::size_t column = 0; column < columns.size(); column++)
+      {
+        if (column != 0)
+        {
+          buffer += ", ";
+        };
+        std::visit([&](auto const &span) { cellToString(span[row]); }, columns[column]);
+      };
+      buffer += ')';
+    };
+  }
+
+  /// @brief      Appends the values for an INSERT query to the output buffer.
+  /// @param[out] buffer: The buffer to append to.
+  /// @param[in]  values: The values to convert to a string.
+  /// @version    2026-10-16/GGB - Changed to append to a buffer rather than returning a string.
+  /// @version    2022-07-23/GGB - Function created.
+
+  void sqlWriter::appendTo(std::string &buffer, valueStorage_t const &valueFields) const
+  {
+    bool firstRow = true;
+
+    buffer += "VALUES ";
+
+    for (auto &outerElement : valueFields)
+    {
+      if (firstRow)
+      {
+        firstRow = false;
+      }
+      else
+      {
+        buffer += ", ";
+      }
+
+      buffer += '(';
+      appendList(buffer, outerElement);
+      buffer += ')';
+    };
+  }
+
+  sqlWriter::operatorMap_t sqlWriter::operatorMap =
+  {
+    {eq, "="},
+    {gt, ">"},
+    {lt, "<"},
+    {gte, ">="},
+    {lte, "<="},
+    {neq, "!="},
+    {nse, "<=>"},
+    {in, "IN"},
+    {between, "BETWEEN"},
+    {nin, "NOT IN"},
+  };
+
+  sqlWriter::logicalOperatorMap_t sqlWriter::logicalOperatorMap =
+  {
+    {AND, "AND"},
+    {OR, "OR"},
+    {XOR, "XOR"},
+    {NOT, "NOT"}
+  };
+
+  /// @brief      Creates the command that starts a bulk load into the insert table. For POSTGRE this is a COPY ... FROM STDIN
+  ///             command. For MYSQL this is a LOAD DATA LOCAL INFILE command.
+  /// @param[out] buffer: The buffer to append the command to.
+  /// @param[in]  format: The payload format. MYSQL only supports BULK_TEXT.
+  /// @param[in]  fileName: The file name for LOAD DATA LOCAL INFILE. The client library supplies the payload for this name.
+  ///             (Not used for POSTGRE)
+  /// @throws     GCL::CRuntimeAssert
+  /// @version    2026-10-16/GGB - Function created.
+
+  void sqlWriter::bulkLoadCommand(std::string &buffer, EBulkFormat format, std::string const &fileName) const
+  {
+    RUNTIME_ASSERT(queryType == qt_insert, boost::locale::translate("Bulk load requires an insert query."));
+    RUNTIME_ASSERT(!selectFields.empty(), boost::locale::translate("Bulk load requires the insert columns."));
+
+    switch (dialect)
+    {
+      case POSTGRE:
+      {
+        buffer += "COPY ";
+        buffer += insertTable;
+        buffer += " (";
+        appendList(buffer, selectFields);
+        buffer += ") FROM STDIN";
+        if (format == BULK_BINARY)
+        {
+          buffer += " WITH (FORMAT binary)";
+        };
+        break;
+      }
+      case MYSQL:
+      {
+        RUNTIME_ASSERT(format == BULK_TEXT, boost::locale::translate("MYSQL only supports text bulk loads."));
+        RUNTIME_ASSERT(!fileName.empty(), boost::locale::translate("LOAD DATA requires a file name."));
+
+        buffer += "LOAD DATA LOCAL INFILE ";
+        appendStringLiteral(buffer, fileName, SL_MYSQL);
+        buffer += " INTO TABLE ";
+        buffer += insertTable;
+        buffer += " FIELDS TERMINATED BY '\\t' ESCAPED BY '\\\\' LINES TERMINATED BY '\\n' (";
+        appendList(buffer, selectFields);
+        buffer += ')';
+        break;
+      }
+      default:
+      {
+        RUNTIME_ERROR(boost::locale::translate("Bulk load not supported for dialect."));
+      }
+    }
+  }
+
+  /// @brief      Creates the bulk load payload for the rows in the insert query. (values())
+  /// @param[out] buffer: The buffer to append the payload to.
+  /// @param[in]  format: The payload format.
+  /// @throws     GCL::CRuntimeAssert
+  /// @version    2026-10-16/GGB - Function created.
+
+  void sqlWriter::bulkLoadPayload(std::string &buffer, EBulkFormat format) const
+  {
+    RUNTIME_ASSERT(std::holds_alternative<valueStorage_t>(insertValue) || std::holds_alternative<columnStorage_t>(insertValue),
+                   boost::locale::translate("Bulk load requires the values to be defined."));
+    RUNTIME_ASSERT((format == BULK_TEXT) || (dialect == POSTGRE), boost::locale::translate("Binary bulk load requires POSTGRE."));
+
+    appendBulkHeader(buffer, format);
+    if (std::holds_alternative<valueStorage_t>(insertValue))
+    {
+      for (auto const &row : std::get<valueStorage_t>(insertValue))
+      {
+        appendBulkRow(buffer, row, format);
+      };
+    }
+    else
+    {
+      columnStorage_t const &columns = std::get<columnStorage_t>(insertValue);
+      std::size_t const rows = columns.empty() ? 0 : columnLength(columns.front());
+
+      for (std::size_t row = 0; row < rows; row++)
+      {
+        if (format == BULK_BINARY)
+        {
+          appendBigEndian(buffer, static_cast<std::int16_t>(columns.size()));
+          for (auto const &column : columns)
+          {
+            std::visit([&](auto const &span) { parameter_to_bulkBinary{buffer}(span[row]); }, column);
+          };
+        }
+        else
+        {
+          for (std::size_t column = 0; column < columns.size(); column++)
+          {
+            if (column != 0)
+            {
+              buffer += '\t';
+            };
+            std::visit([&](auto const &span) { parameter_to_bulkText{buffer, dialect == MYSQL}(span[row]); }, columns[column]);
+          };
+          buffer += '\n';
+        };
+      };
+    };
+    appendBulkTrailer(buffer, format);
+  }
+
+  /// @brief      Streams rows into a bulk load payload. The payload is passed to the sink in pieces of approximately
+  ///             chunkBytes. The pieces must be sent to the server in order. (PQputCopyData() or the LOCAL INFILE handler)
+  /// @param[in]  source: Called to fetch each row. See insertStream().
+  /// @param[in]  sink: Called with each piece of the payload and the number of rows in the piece.
+  /// @param[in]  format: The payload format.
+  /// @param[in]  chunkBytes: The size at which a piece is passed to the sink.
+  /// @returns    The total number of rows.
+  /// @throws     GCL::CRuntimeAssert
+  /// @note       The payload buffer and the row vector are re-used between pieces.
+  /// @version    2026-10-16/GGB - Function created.
+
+  std::size_t sqlWriter::bulkLoadStream(rowSource_t const &source, statementSink_t const &sink, EBulkFormat format,
+                                        std::size_t chunkBytes) const
+  {
+    RUNTIME_ASSERT(!selectFields.empty(), boost::locale::translate("Bulk load requires the insert columns."));
+    RUNTIME_ASSERT((format == BULK_TEXT) || (dialect == POSTGRE), boost::locale::translate("Binary bulk load requires POSTGRE."));
+
+    std::string payload;
+    parameterVector_t row(selectFields.size());
+    std::size_t chunkRows = 0;
+    std::size_t totalRows = 0;
+
+    payload.reserve(chunkBytes);
+    appendBulkHeader(payload, format);
+
+    while (source(row))
+    {
+      appendBulkRow(payload, row, format);
+      chunkRows++;
+      totalRows++;
+
+      if (payload.size() >= chunkBytes)
+      {
+        sink(payload, chunkRows);
+        payload.clear();
+        chunkRows = 0;
+      };
+    };
 
-    return returnValue;
+    appendBulkTrailer(payload, format);
+    sink(payload, chunkRows);
+
+    return totalRows;
   }
 
-  /// @brief      Creates the string for the values for an INSERT query.
-  /// @param[in]  values: The values to convert to a string.
-  /// @version    2022-07-23/GGB - Function created.
+  /// @brief      Appends the bulk load header. (Binary COPY signature)
+  /// @param[out] buffer: The buffer to append to.
+  /// @param[in]  format: The payload format.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
 
-  std::string sqlWriter::to_string(valueType_t const &values) const
+  void sqlWriter::appendBulkHeader(std::string &buffer, EBulkFormat format) const
   {
-    std::string returnValue;
-
-    std::visit(overloaded
+    if (format == BULK_BINARY)
     {
-      [&](std::monostate const &) { CODE_ERROR(); },
-      [&](valueStorage_t const &vs) { returnValue = to_string(vs); },
-      [&](pointer_t const &pt) { returnValue = "( " + static_cast<std::string>(*pt) + ") "; },
-    }, values);
+      static constexpr char signature[] = "PGCOPY\n\377\r\n";
 
-    return returnValue;
+      buffer.append(signature, sizeof(signature));      // Includes the terminating NUL.
+      appendBigEndian(buffer, std::int32_t(0));         // Flags
+      appendBigEndian(buffer, std::int32_t(0));         // Header extension length
+    };
   }
 
-  /// @brief      Creates the string for the values for an INSERT query.
-  /// @param[in]  values: The values to convert to a string.
-  /// @version    2022-07-23/GGB - Function created.
+  /// @brief      Appends a single row to a bulk load payload.
+  /// @param[out] buffer: The buffer to append to.
+  /// @param[in]  row: The row of values. One per column.
+  /// @param[in]  format: The payload format.
+  /// @throws     GCL::CRuntimeAssert
+  /// @version    2026-10-16/GGB - Function created.
 
-  std::string sqlWriter::to_string(valueStorage_t const &valueFields) const
+  void sqlWriter::appendBulkRow(std::string &buffer, parameterVector_t const &row, EBulkFormat format) const
   {
-    bool firstValue = true;
-    bool firstRow = true;
-
-    std::string returnValue = "VALUES ";
+    RUNTIME_ASSERT(row.size() == selectFields.size(), boost::locale::translate("Row size does not match the column count."));
 
-    for (auto &outerElement : valueFields)
+    if (format == BULK_BINARY)
     {
-      if (firstRow)
-      {
-        firstRow = false;
-      }
-      else
+      appendBigEndian(buffer, static_cast<std::int16_t>(row.size()));
+      for (auto const &p : row)
       {
-        returnValue += ", ";
-      }
-
-      firstValue = true;
-      returnValue += "(";
+        std::visit(parameter_to_bulkBinary{buffer}, p);
+      };
+    }
+    else
+    {
+      bool first = true;
 
-      for (auto & innerElement : outerElement)
+      for (auto const &p : row)
       {
-        if (firstValue)
+        if (first)
         {
-          firstValue = false;
+          first = false;
         }
         else
         {
-          returnValue += ", ";
+          buffer += '\t';
         };
-
-        returnValue += to_string(innerElement);
+        std::visit(parameter_to_bulkText{buffer, dialect == MYSQL}, p);
       };
-
-      returnValue += ")";
+      buffer += '\n';
     };
-
-    return returnValue;
   }
 
-  sqlWriter::operatorMap_t sqlWriter::operatorMap =
-  {
-    {eq, "="},
-    {gt, ">"},
-    {lt, "<"},
-    {gte, ">="},
-    {lte, "<="},
-    {neq, "!="},
-    {nse, "<=>"},
-    {in, "IN"},
-    {between, "BETWEEN"},
-    {nin, "NOT IN"},
-  };
+  /// @brief      Appends the bulk load trailer. (Binary COPY end marker)
+  /// @param[out] buffer: The buffer to append to.
+  /// @param[in]  format: The payload format.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
 
-  sqlWriter::logicalOperatorMap_t sqlWriter::logicalOperatorMap =
+  void sqlWriter::appendBulkTrailer(std::string &buffer, EBulkFormat format) const
   {
-    {AND, "AND"},
-    {OR, "OR"},
-    {XOR, "XOR"},
-    {NOT, "NOT"}
-  };
+    if (format == BULK_BINARY)
+    {
+      appendBigEndian(buffer, std::int16_t(-1));
+    };
+  }
 
   /// @brief      Function to create a call procedure.
   /// @param[in]  procedureName: The name of the procedure to call.
@@ -701,6 +1944,263 @@ namespace GCL
     return (*this);
   }
 
+  /// @brief      Collects the types of the placeholders in the query. The placeholders are collected in the same order that
+  ///             they are rendered by appendTo().
+  /// @param[out] slots: The vector to append the placeholder types to.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
+
+  void sqlWriter::collectSlots(std::vector<parameterType_t> &slots) const
+  {
+    std::size_t const start = slots.size();
+
+    visitPlaceholders(overloaded
+    {
+      [&](parameter_t const *p)
+      {
+        slots.push_back(((p == nullptr) || std::holds_alternative<bindValue_t>(*p)) ? PT_NONE : parameterType(*p));
+      },
+      [&](std::int64_t const &) { slots.push_back(PT_I64); },
+      [&](double const &) { slots.push_back(PT_DOUBLE); },
+      [&](std::string_view const &) { slots.push_back(PT_STRING); },
+    });
+
+    if ( (queryType == qt_insert) && preparedStatement_ && (slots.size() - start > selectFields.size()) )
+    {
+        // The prepared text only has one row of placeholders. The types are taken from the last row of values.
+
+      slots.erase(slots.begin() + start, slots.end() - selectFields.size());
+    };
+  }
+
+  /// @brief      Visits the placeholders in the query in the same order that they are rendered by appendTo(). The visitor is
+  ///             called with a pointer to the value for the placeholder.
+  /// @param[in]  visitor: Callable taking a parameter_t const *. The pointer is nullptr if the placeholder has no value.
+  ///             For column-wise insert values the visitor is called with the cell. (std::int64_t, double or std::string_view)
+  /// @throws     None.
+  /// @note       For prepared insert queries every row of values is visited, row by row. The text only has one row of
+  ///             placeholders.
+  /// @version    2026-10-16/GGB - Function created.
+
+  template<typename F>
+  void sqlWriter::visitPlaceholders(F &&visitor) const
+  {
+    switch (queryType)
+    {
+      case qt_select:
+      {
+        for (auto const &element : fromFields)
+        {
+          if (std::holds_alternative<pointer_t>(std::get<0>(element)))
+          {
+            std::get<pointer_t>(std::get<0>(element))->visitPlaceholders(visitor);
+          };
+        };
+        visitPlaceholders(visitor, whereClause_);
+
+          // The seek keys are rendered once each for a row value, and as K1, K1 K2, K1 K2 K3... for the expanded form.
+
+        if (!seekKeys_.empty())
+        {
+          for (std::size_t term = seekRowValue() ? seekKeys_.size() - 1 : 0; term < seekKeys_.size(); term++)
+          {
+            for (std::size_t index = 0; index <= term; index++)
+            {
+              if (preparedStatement_)
+              {
+                visitor(&seekKeys_[index]);
+              }
+              else
+              {
+                visitPlaceholder(visitor, seekKeys_[index]);
+              };
+            };
+          };
+        };
+        break;
+      }
+      case qt_upsert:
+      {
+        if (!setFields.empty())
+        {
+            // upsert().set() queries render the set values twice. Once in the VALUES clause and once in the UPDATE clause.
+
+          for (int pass = 0; pass < 2; pass++)
+          {
+            for (auto const &element : setFields)
+            {
+              if (preparedStatement_)
+              {
+                visitor(&element.second);
+              }
+              else
+              {
+                visitPlaceholder(visitor, element.second);
+              };
+            };
+          };
+          break;
+        };
+        [[fallthrough]];      // Multi-row upserts hold the rows in the same way as inserts.
+      }
+      case qt_insert:
+      {
+        if (preparedStatement_)
+        {
+          if (std::holds_alternative<valueStorage_t>(insertValue) && !std::get<valueStorage_t>(insertValue).empty())
+          {
+            for (auto const &row : std::get<valueStorage_t>(insertValue))
+            {
+              for (std::size_t index = 0; index < selectFields.size(); index++)
+              {
+                visitor(&row.at(index));
+              };
+            };
+          }
+          else if (std::holds_alternative<columnStorage_t>(insertValue))
+          {
+            columnStorage_t const &columns = std::get<columnStorage_t>(insertValue);
+            std::size_t const rows = columns.empty() ? 0 : columnLength(columns.front());
+
+            for (std::size_t row = 0; row < rows; row++)
+            {
+              for (auto const &column : columns)
+              {
+                std::visit([&](auto const &span) { visitor(span[row]); }, column);
+              };
+            };
+          }
+          else
+          {
+            for (std::size_t index = 0; index < selectFields.size(); index++)
+            {
+              visitor(nullptr);
+            };
+          };
+        }
+        else if (std::holds_alternative<valueStorage_t>(insertValue))
+        {
+          for (auto const &row : std::get<valueStorage_t>(insertValue))
+          {
+            for (auto const &p : row)
+            {
+              visitPlaceholder(visitor, p);
+            };
+          };
+        }
+        else if (std::holds_alternative<pointer_t>(insertValue))
+        {
+          std::get<pointer_t>(insertValue)->visitPlaceholders(visitor);
+        };
+        break;
+      }
+      case qt_update:
+      {
+        for (auto const &element : setFields)
+        {
+          if (preparedStatement_)
+          {
+            visitor(&element.second);
+          }
+          else
+          {
+            visitPlaceholder(visitor, element.second);
+          };
+        };
+
+        visitPlaceholders(visitor, whereClause_);
+        break;
+      }
+      case qt_delete:
+      {
+        visitPlaceholders(visitor, whereClause_);
+        break;
+      }
+      default:
+      {
+        break;
+      }
+    }
+  }
+
+  /// @brief      Visits the placeholders in a where clause.
+  /// @param[in]  visitor: Callable taking a parameter_t const *.
+  /// @param[in]  wv: The where clause.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
+
+  template<typename F>
+  void sqlWriter::visitPlaceholders(F &&visitor, whereVariant_t const &wv) const
+  {
+    std::visit(overloaded
+    {
+      [&](std::monostate const &) { },
+      [&](whereTest_t const &wt)
+      {
+        EInList const strategy = inListStrategy(wt);
+
+        if (strategy == IN_TEMP_TABLE)
+        {
+            // The values are in the temporary table.
+        }
+        else if ((strategy == IN_ANY) && preparedStatement_)
+        {
+          std::string array;
+
+          std::visit(overloaded
+          {
+            [&](parameterVector_t const &pv) { appendArrayLiteral(array, pv); },
+            [&](parameterSet_t const &ps) { appendArrayLiteral(array, ps); },
+            [&](auto const &) { CODE_ERROR(); },
+          }, std::get<2>(wt));
+          visitor(std::string_view(array));
+        }
+        else
+        {
+          std::visit(overloaded
+          {
+            [&](parameter_t const &p) { visitPlaceholder(visitor, p); },
+            [&](parameterVector_t const &pv) { for (auto const &p : pv) { visitPlaceholder(visitor, p); } },
+            [&](parameterSet_t const &ps) { for (auto const &p : ps) { visitPlaceholder(visitor, p); } },
+            [&](pointer_t const &pt) { pt->visitPlaceholders(visitor); },
+          }, std::get<2>(wt));
+        };
+      },
+      [&](whereLogical_t const &wl)
+      {
+        visitPlaceholders(visitor, *std::get<0>(wl));
+        visitPlaceholders(visitor, *std::get<2>(wl));
+      },
+    }, wv.base);
+  }
+
+  /// @brief      Visits a single parameter if it is rendered as a placeholder. Only strings in prepared statements and bind
+  ///             values are rendered as placeholders.
+  /// @param[in]  visitor: Callable taking a parameter_t const *.
+  /// @param[in]  p: The parameter.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
+
+  template<typename F>
+  void sqlWriter::visitPlaceholder(F &&visitor, parameter_t const &p) const
+  {
+    if (std::holds_alternative<bindValue_t>(p) || (preparedStatement_ && std::holds_alternative<std::string>(p)))
+    {
+      visitor(&p);
+    };
+  }
+
+  /// @brief      Returns the number of values in a column.
+  /// @param[in]  column: The column.
+  /// @returns    The number of values.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
+
+  std::size_t sqlWriter::columnLength(column_t const &column) noexcept
+  {
+    return std::visit([](auto const &span) { return span.size(); }, column);
+  }
+
   /// @brief      Returns the number of columns affected.
   /// @details    The number of columns returned is dependant on the type of query.
   /// @returns    The number of columns. This is dependent on the type of query.
@@ -714,6 +2214,7 @@ namespace GCL
     switch (queryType)
     {
       case qt_insert:
+      case qt_upsert:
       {
         rv = selectFields.size();
         break;
@@ -741,12 +2242,19 @@ namespace GCL
     switch (queryType)
     {
       case qt_insert:
+      case qt_upsert:
       {
         if (std::holds_alternative<valueStorage_t>(insertValue))
         {
           valueStorage_t const valueStorage = std::get<valueStorage_t>(insertValue);
           parameterVector_t const &parameters = valueStorage.back();
           rv = parameterType(parameters[columnNo]);
+        }
+        else if (std::holds_alternative<columnStorage_t>(insertValue))
+        {
+          static parameterType_t const columnTypes[] = { PT_I64, PT_DOUBLE, PT_STRING };
+
+          rv = columnTypes[std::get<columnStorage_t>(insertValue).at(columnNo).index()];
         };
         break;
       }
@@ -760,6 +2268,25 @@ namespace GCL
     return rv;
   }
 
+  /// @brief      Compiles the query into a compiled statement. The text of the statement is rendered once and the placeholders
+  ///             are collected into a flat slot array. Values can then be bound to the compiled statement without walking the
+  ///             query tree.
+  /// @returns    The compiled statement.
+  /// @throws     std::bad_alloc
+  /// @note       The statement cache is used to render the text if it is enabled.
+  /// @version    2026-10-16/GGB - Function created.
+
+  sqlCompiledStatement sqlWriter::compile() const
+  {
+    std::string text;
+    std::vector<parameterType_t> slots;
+
+    appendTo(text);
+    collectSlots(slots);
+
+    return sqlCompiledStatement(std::move(text), std::move(slots));
+  }
+
   /// @brief      Function to capture the count expression
   /// @param[in]  countExpression: The count expression to capture.
   /// @param[in]  countAs: The name for the count expression.
@@ -777,83 +2304,64 @@ namespace GCL
   }
 
   /// @brief      Creates the string for the call including parameters.
-  /// @returns    a string representation of stored procedure call.
+  /// @param[out] buffer: The buffer to append the call to.
+  /// @version    2026-10-16/GGB - Changed to append to a buffer rather than returning a string.
   /// @version    2021-04-13/GGB - Function created.
 
-  std::string sqlWriter::createCall() const
+  void sqlWriter::createCall(std::string &buffer) const
   {
     bool commaRequired = false;
-    std::string returnValue = "CALL ";
 
-    returnValue += procedureName_ + "(";
+    buffer += "CALL ";
+    buffer += procedureName_;
+    buffer += '(';
 
     for (auto const &param: procedureParameters_)
     {
       if (commaRequired)
       {
-        returnValue += ", ";
+        buffer += ", ";
       }
       else
       {
         commaRequired = true;
       };
-      returnValue += "'" + to_string(param) + "'";
+      buffer += '\'';
+      appendTo(buffer, param);
+      buffer += '\'';
     }
 
-    returnValue += ")";
-
-    return returnValue;
+    buffer += ')';
   }
 
   /// @brief      Creates the test for the specified delete query.
-  /// @returns    a string representation of the delete query.
+  /// @param[out] buffer: The buffer to append the query to.
+  /// @version    2026-10-16/GGB - The table name is rendered as given, as for the other query types.
+  /// @version    2026-10-16/GGB - Changed to append to a buffer rather than returning a string.
   /// @version    2018-05-12/GGB - Function created.
 
-  std::string sqlWriter::createDeleteQuery() const
+  void sqlWriter::createDeleteQuery(std::string &buffer) const
   {
-    std::string returnValue = "DELETE FROM ";
+    buffer += "DELETE FROM ";
+    buffer += deleteTable;
 
-    returnValue += getColumnMappedName(deleteTable);
-
-    returnValue += createWhereClause();
-
-    return returnValue;
+    createWhereClause(buffer);
   }
 
   /// @brief      Creates the string for an insert query.
-  /// @param[in]  preparedQuery: true if the quewry should be a prepared query.
-  /// @returns    The Insert Query as a string.
+  /// @param[out] buffer: The buffer to append the query to.
   /// @throws     None.
+  /// @version    2026-10-16/GGB - Changed to append to a buffer rather than returning a string.
   /// @version    2023-09-23/GGB - Added the parameter preparedQuery to support preparedQueries.
   /// @version    2022-07-23/GGB - Changed the value storage to valueType_t and useing std::variant
   /// @version    2022-05-01/GGB - Added support for the 'RETURNING' function.
   /// @version    2015-03-31/GGB - Function created.
 
-  std::string sqlWriter::createInsertQuery() const
+  void sqlWriter::createInsertQuery(std::string &buffer) const
   {
-    std::string returnValue = "INSERT INTO " + insertTable + " (";
     bool firstValue = true;
 
-      // Output the column names.
-
-    for (auto &element : selectFields)
-    {
-      std::string columnName;
-
-      if (firstValue)
-      {
-        firstValue = false;
-      }
-      else
-      {
-        returnValue += ", ";
-      };
-      columnName = to_string(element);
-
-      returnValue += columnName;
-    };
-
-    returnValue += ") ";
+    createInsertHead(buffer);
 
     if (preparedStatement_)
     {
@@ -861,7 +2369,7 @@ namespace GCL
 
       if (placeHolderCount >= 1)
       {
-        returnValue += " VALUES (";
+        buffer += " VALUES (";
         firstValue = true;
 
         while (placeHolderCount)
@@ -869,26 +2377,81 @@ namespace GCL
           if (firstValue)
           {
             firstValue = false;
-            returnValue += " ?";
+            buffer += " ?";
           }
           else
           {
-            returnValue += ", ?";
+            buffer += ", ?";
           }
           placeHolderCount--;
         }
-        returnValue += ") ";
+        buffer += ") ";
       }
     }
     else
     {
-      returnValue += to_string(insertValue);      /// Creates the VALUES clause.
+      appendTo(buffer, insertValue);      /// Creates the VALUES clause.
+    };
+
+    createReturningClause(buffer);
+  }
+
+  /// @brief      Creates the start of an insert query. (INSERT INTO table (columns) )
+  /// @param[out] buffer: The buffer to append the text to.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - The INTO clause is created by createIntoClause().
+  /// @version    2026-10-16/GGB - Function created. (Split from createInsertQuery())
+
+  void sqlWriter::createInsertHead(std::string &buffer) const
+  {
+    buffer += "INSERT ";
+    createIntoClause(buffer);
+  }
+
+  /// @brief      Creates the INTO clause of an insert query. (INTO table (columns) )
+  /// @param[out] buffer: The buffer to append the text to.
+  /// @throws     None.
+  /// @note       Used on its own for each row of an ORACLE INSERT ALL statement.
+  /// @version    2026-10-16/GGB - Function created. (Split from createInsertHead())
+
+  void sqlWriter::createIntoClause(std::string &buffer) const
+  {
+    bool firstValue = true;
+
+    buffer += "INTO ";
+    buffer += insertTable;
+    buffer += " (";
+
+      // Output the column names.
+
+    for (auto &element : selectFields)
+    {
+      if (firstValue)
+      {
+        firstValue = false;
+      }
+      else
+      {
+        buffer += ", ";
+      };
+      appendTo(buffer, element);
     };
 
+    buffer += ") ";
+  }
+
+  /// @brief      Creates the RETURNING clause if there are returning fields.
+  /// @param[out] buffer: The buffer to append the clause to.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created. (Split from createInsertQuery())
+
+  void sqlWriter::createReturningClause(std::string &buffer) const
+  {
     if (!returningFields_.empty())
     {
-      returnValue += " RETURNING ";
-      firstValue = true;
+      bool firstValue = true;
+
+      buffer += " RETURNING ";
 
       for (std::string const &v : returningFields_)
       {
@@ -898,24 +2461,24 @@ namespace GCL
         }
         else
         {
-          returnValue += ", ";
+          buffer += ", ";
         }
-        returnValue += v;
+        buffer += v;
       };
     }
-
-    return returnValue;
   }
 
   /// @brief    Creates the limit clause
+  /// @param[out] buffer: The buffer to append the clause to.
   /// @throws   None.
+  /// @note     MICROSOFT uses TOP in the select clause unless there is an offset. OFFSET requires an ORDER BY clause.
+  /// @version  2026-10-16/GGB - Added POSTGRE, ORACLE and MICROSOFT.
+  /// @version  2026-10-16/GGB - Changed to append to a buffer rather than returning a string.
   /// @version  2022-05-10/GGB - Bug Fix (#226)
   /// @version  2020-04-25/GGB - Function created.
 
-  std::string sqlWriter::createLimitClause() const
+  void sqlWriter::createLimitClause(std::string &buffer) const
   {
-    std::string returnValue;
-
     switch (dialect)
     {
       case MYSQL:
@@ -924,20 +2487,58 @@ namespace GCL
 
         if (offsetValue)
         {
-          returnValue = " LIMIT " + std::to_string(*offsetValue) + ", "
-                        + std::to_string(limitValue ? *limitValue : std::numeric_limits<std::uint64_t>::max()) + " ";
+          buffer += " LIMIT ";
+          buffer += std::to_string(*offsetValue);
+          buffer += ", ";
+          buffer += std::to_string(limitValue ? *limitValue : std::numeric_limits<std::uint64_t>::max());
+          buffer += ' ';
         }
         else
         {
           if (limitValue)
           {
-            returnValue = " LIMIT " + std::to_string(*limitValue) + " ";
+            buffer += " LIMIT ";
+            buffer += std::to_string(*limitValue);
+            buffer += ' ';
           };
         };
         break;
       };
       case POSTGRE:
       {
+        if (limitValue)
+        {
+          buffer += " LIMIT ";
+          buffer += std::to_string(*limitValue);
+        };
+        if (offsetValue)
+        {
+          buffer += " OFFSET ";
+          buffer += std::to_string(*offsetValue);
+        };
+        break;
+      }
+      case ORACLE:
+      case MICROSOFT:
+      {
+        if (offsetValue)
+        {
+          buffer += " OFFSET ";
+          buffer += std::to_string(*offsetValue);
+          buffer += " ROWS";
+          if (limitValue)
+          {
+            buffer += " FETCH NEXT ";
+            buffer += std::to_string(*limitValue);
+            buffer += " ROWS ONLY";
+          };
+        }
+        else if (limitValue && (dialect == ORACLE))
+        {
+          buffer += " FETCH FIRST ";
+          buffer += std::to_string(*limitValue);
+          buffer += " ROWS ONLY";
+        };
         break;
       }
       default:
@@ -945,26 +2546,109 @@ namespace GCL
         RUNTIME_ERROR(boost::locale::translate("Unknown dialect"));
       }
     }
+  }
 
-    return returnValue;
+  /// @brief      Creates the keyset (seek) condition of a select query. The condition selects the rows after the last seen
+  ///             key values in the order of the order by clause. It is added to the where clause.
+  /// @param[out] buffer: The buffer to append the condition to.
+  /// @throws     GCL::CRuntimeAssert
+  /// @note       Row value comparisons are used if the dialect supports them and all the order by columns have the same
+  ///             direction. @c ((K1, K2) > (1, 2)) Otherwise the comparison is expanded. @c ((K1 > 1) OR (K1 = 1 AND K2 > 2))
+  /// @version    2026-10-16/GGB - Function created.
+
+  void sqlWriter::createSeekClause(std::string &buffer) const
+  {
+    auto const appendKey = [&](parameter_t const &key)
+    {
+      if (preparedStatement_ && !std::holds_alternative<bindValue_t>(key))
+      {
+        buffer += '?';
+      }
+      else
+      {
+        appendTo(buffer, key);
+      };
+    };
+    auto const appendCompare = [&](std::size_t index)
+    {
+      buffer += (orderByFields[index].second == DESC) ? " < " : " > ";
+    };
+
+    if (!seekKeys_.empty())
+    {
+      RUNTIME_ASSERT(seekKeys_.size() == orderByFields.size(),
+                     boost::locale::translate("The seek keys must match the order by columns."));
+
+      buffer += std::holds_alternative<std::monostate>(whereClause_.base) ? " WHERE (" : " AND (";
+
+      if (seekRowValue())
+      {
+        buffer += '(';
+        for (std::size_t index = 0; index < orderByFields.size(); index++)
+        {
+          if (index != 0)
+          {
+            buffer += ", ";
+          };
+          buffer += orderByFields[index].first;
+        };
+        buffer += ')';
+        appendCompare(0);
+        buffer += '(';
+        for (std::size_t index = 0; index < seekKeys_.size(); index++)
+        {
+          if (index != 0)
+          {
+            buffer += ", ";
+          };
+          appendKey(seekKeys_[index]);
+        };
+        buffer += ')';
+      }
+      else
+      {
+        for (std::size_t term = 0; term < seekKeys_.size(); term++)
+        {
+          if (term != 0)
+          {
+            buffer += " OR ";
+          };
+          buffer += '(';
+          for (std::size_t index = 0; index < term; index++)
+          {
+            buffer += orderByFields[index].first;
+            buffer += " = ";
+            appendKey(seekKeys_[index]);
+            buffer += " AND ";
+          };
+          buffer += orderByFields[term].first;
+          appendCompare(term);
+          appendKey(seekKeys_[term]);
+          buffer += ')';
+        };
+      };
+
+      buffer += ')';
+    };
   }
 
   /// @brief      Creates the set clause.
+  /// @param[out] buffer: The buffer to append the clause to.
   /// @param[in]  preparedQuery: Create a prepared query.
   /// @throws     GCL::CRuntimeAssert
+  /// @version    2026-10-16/GGB - Changed to append to a buffer rather than returning a string.
   /// @version    2023-09-26/GGB - Added support for prepared queries.
   /// @version    2017-08-21/GGB - Function created.
 
-  std::string sqlWriter::createSetClause(bool preparedQuery) const
+  void sqlWriter::createSetClause(std::string &buffer, bool preparedQuery) const
   {
     RUNTIME_ASSERT(!setFields.empty(), boost::locale::translate("No Set fields defined for update query."));
 
-    std::string returnValue = "SET ";
-
-
     bool firstValue = true;
 
-    for (auto element : setFields)
+    buffer += "SET ";
+
+    for (auto const &element : setFields)
     {
       if (firstValue)
       {
@@ -972,60 +2656,240 @@ namespace GCL
       }
       else
       {
-        returnValue += ", ";
+        buffer += ", ";
       };
-      returnValue += element.first + " = ";
+      buffer += element.first;
+      buffer += " = ";
 
-      returnValue += preparedQuery ? "?" : to_string(element.second);
+      if (preparedQuery)
+      {
+        buffer += '?';
+      }
+      else
+      {
+        appendTo(buffer, element.second);
+      }
     };
-
-    return returnValue;
   }
 
   /// @brief      Converts the query to a string. Specifically for an update query.
-  /// @param[in]  preparedQuery: Create a prepared query.
+  /// @param[out] buffer: The buffer to append the query to.
   /// @throws
+  /// @version    2026-10-16/GGB - Changed to append to a buffer rather than returning a string.
   /// @version    2023-09-26/GGB - Added support for prepared queries.
   /// @version    2017-08-21/GGB - Function created.
 
-  std::string sqlWriter::createUpdateQuery() const
+  void sqlWriter::createUpdateQuery(std::string &buffer) const
   {
-    std::string returnValue = "UPDATE " + updateTable + " ";
-
-    returnValue += createSetClause(preparedStatement_);
+    buffer += "UPDATE ";
+    buffer += updateTable;
+    buffer += ' ';
 
-    returnValue += createWhereClause();
-
-    return returnValue;
+    createSetClause(buffer, preparedStatement_);
+    createWhereClause(buffer);
   }
 
   /// @brief      Converts the upsert query to a string.
+  /// @details    upsert(table, {columns}).values(rows).onConflict({keys}) renders one statement for all the rows.
+  ///               MYSQL:      INSERT INTO ... VALUES (...), (...) ON DUPLICATE KEY UPDATE col = VALUES(col)
+  ///               POSTGRE:    INSERT INTO ... VALUES (...), (...) ON CONFLICT (keys) DO UPDATE SET col = EXCLUDED.col
+  ///               MICROSOFT:  MERGE INTO ... USING (VALUES (...), (...)) AS SRC (columns) ON (...) WHEN MATCHED ...
+  ///               ORACLE:     MERGE INTO ... USING (SELECT ... FROM DUAL UNION ALL ...) SRC ON (...) WHEN MATCHED ...
+  ///             The conflict keys are not updated. upsert(table).set() is only supported for MYSQL.
+  /// @param[out] buffer: The buffer to append the query to.
   /// @throws     GCL::CRuntimeError
+  /// @version    2026-10-16/GGB - Column names are rendered as given, as for the other query types.
+  /// @version    2026-10-16/GGB - Added multi-row upserts for all dialects.
+  /// @version    2026-10-16/GGB - Changed to append to a buffer rather than returning a string.
   /// @version    2023-09-26/GGB - Added support for prepared queries
   /// @version    2021-11-18/GGB - Updated to use std::variant with the where fields.
   /// @version    2019-12-08/GGB - Function created.
 
-  std::string sqlWriter::createUpsertQuery() const
+  void sqlWriter::createUpsertQuery(std::string &buffer) const
   {
-    // Notes:
-    //  1. The where() clauses should be populated. These need to be converted to insert clauses for the insert function.
-    //  2. The set clause needs to be included in the insert clauses.
+    if (setFields.empty())
+    {
+      RUNTIME_ASSERT(!selectFields.empty(), boost::locale::translate("Upsert requires the columns."));
+      RUNTIME_ASSERT(std::holds_alternative<valueStorage_t>(insertValue) ||
+                     (preparedStatement_ && std::holds_alternative<std::monostate>(insertValue)),
+                     boost::locale::translate("Upsert requires row values."));
 
-    RUNTIME_ASSERT(dialect == MYSQL, boost::locale::translate("Upsert only implemented for MYSQL."));
+      createUpsertHead(buffer);
 
-    std::string returnValue;
-    std::string fieldNames;
-    std::string fieldValues;
-    bool firstValue = true;
+      if (std::holds_alternative<valueStorage_t>(insertValue) && !std::get<valueStorage_t>(insertValue).empty())
+      {
+        bool firstRow = true;
+
+        for (auto const &row : std::get<valueStorage_t>(insertValue))
+        {
+          if (firstRow)
+          {
+            firstRow = false;
+          }
+          else
+          {
+            buffer += (dialect == ORACLE) ? " UNION ALL " : ", ";
+          };
+          appendUpsertRow(buffer, row);
+        };
+      }
+      else
+      {
+        appendUpsertRow(buffer, parameterVector_t{});     // One row of placeholders.
+      };
+
+      createUpsertTail(buffer);
+    }
+    else
+    {
+        // Notes:
+        //  1. The where() clauses should be populated. These need to be converted to insert clauses for the insert function.
+        //  2. The set clause needs to be included in the insert clauses.
+
+      RUNTIME_ASSERT(dialect == MYSQL, boost::locale::translate("upsert().set() only implemented for MYSQL. Use upsert(table, {columns})."));
+
+      bool firstValue = true;
+
+      switch(dialect)
+      {
+        case MYSQL:
+        {
+          buffer += "INSERT INTO ";
+          buffer += insertTable;
+          buffer += '(';
+
+            // Add the set clause.
+
+          for (auto const &element : setFields)
+          {
+            if (firstValue)
+            {
+              firstValue = false;
+            }
+            else
+            {
+              buffer += ", ";
+            };
+
+            buffer += element.first;
+          };
+
+          buffer += ") VALUES (";
+          firstValue = true;
+
+          for (auto const &element : setFields)
+          {
+            if (firstValue)
+            {
+              firstValue = false;
+            }
+            else
+            {
+              buffer += ", ";
+            };
+
+            if (preparedStatement_)
+            {
+              buffer += '?';
+            }
+            else
+            {
+              appendTo(buffer, element.second);
+            }
+          };
+
+          buffer += ") ON DUPLICATE KEY UPDATE ";
+          firstValue = true;
+
+          for (auto const &element : setFields)
+          {
+            if (firstValue)
+            {
+              firstValue = false;
+            }
+            else
+            {
+              buffer += ", ";
+            };
+            buffer += element.first;
+            buffer += " = ";
+
+            if (preparedStatement_)
+            {
+              buffer += '?';
+            }
+            else
+            {
+              appendTo(buffer, element.second);
+            }
+          };
+
+          break;
+        }
+        default:
+        {
+          CODE_ERROR();
+        }
+      };
+    };
+  }
+
+  /// @brief      Creates the start of an upsert query, up to the first row.
+  /// @param[out] buffer: The buffer to append the text to.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
 
-    switch(dialect)
+  void sqlWriter::createUpsertHead(std::string &buffer) const
+  {
+    switch (dialect)
     {
       case MYSQL:
+      case POSTGRE:
+      {
+        createInsertHead(buffer);
+        buffer += "VALUES ";
+        break;
+      }
+      case MICROSOFT:
+      {
+        buffer += "MERGE INTO ";
+        buffer += insertTable;
+        buffer += " AS TGT USING (VALUES ";
+        break;
+      }
+      case ORACLE:
       {
+        buffer += "MERGE INTO ";
+        buffer += insertTable;
+        buffer += " TGT USING (";
+        break;
+      }
+    };
+  }
 
-          // Add the set clause.
+  /// @brief      Creates the end of an upsert query, after the last row. This is the conflict handling clause.
+  /// @param[out] buffer: The buffer to append the text to.
+  /// @throws     GCL::CRuntimeAssert
+  /// @note       MYSQL uses the unique keys of the table and does not need the conflict keys. If all the columns are conflict
+  ///             keys, MYSQL updates the first column to itself, POSTGRE does nothing and MERGE only inserts.
+  /// @version    2026-10-16/GGB - Function created.
 
-        for (auto const &element : setFields)
+  void sqlWriter::createUpsertTail(std::string &buffer) const
+  {
+    RUNTIME_ASSERT((dialect == MYSQL) || !conflictKeys_.empty(), boost::locale::translate("Upsert requires the conflict keys."));
+
+    bool const updates = std::any_of(selectFields.begin(), selectFields.end(),
+                                     [&](selectExpression_t const &column) { return !isConflictKey(column); });
+
+      // Appends "target column = source column" for each column that is not a conflict key.
+
+    auto const appendUpdates = [&](std::string_view target, std::string_view source, std::string_view close)
+    {
+      bool firstValue = true;
+
+      for (auto const &column : selectFields)
+      {
+        if (!isConflictKey(column))
         {
           if (firstValue)
           {
@@ -1033,25 +2897,94 @@ namespace GCL
           }
           else
           {
-            fieldNames += ", ";
-            fieldValues += ", ";
+            buffer += ", ";
           };
-
-          fieldNames += getColumnMappedName(element.first);
-          fieldValues += preparedStatement_ ? "?" : to_string(element.second);
+          buffer += target;
+          appendTo(buffer, column);
+          buffer += " = ";
+          buffer += source;
+          appendTo(buffer, column);
+          buffer += close;
         };
+      };
+    };
 
-          // Before we can create the insert query, we need to
+      // Appends the column list, each column with a prefix.
 
-        returnValue = "INSERT INTO " + insertTable + "(";
-        returnValue += fieldNames + ") VALUES (";
-        returnValue += fieldValues + ") ";
-        returnValue += "ON DUPLICATE KEY UPDATE ";
+    auto const appendColumns = [&](std::string_view prefix)
+    {
+      bool firstValue = true;
 
-        firstValue = true;
-        fieldValues.clear();
+      for (auto const &column : selectFields)
+      {
+        if (firstValue)
+        {
+          firstValue = false;
+        }
+        else
+        {
+          buffer += ", ";
+        };
+        buffer += prefix;
+        appendTo(buffer, column);
+      };
+    };
 
-        for (auto const &element : setFields)
+    switch (dialect)
+    {
+      case MYSQL:
+      {
+        buffer += " ON DUPLICATE KEY UPDATE ";
+        if (updates)
+        {
+          appendUpdates("", "VALUES(", ")");
+        }
+        else
+        {
+          appendTo(buffer, selectFields.front());
+          buffer += " = ";
+          appendTo(buffer, selectFields.front());
+        };
+        break;
+      }
+      case POSTGRE:
+      {
+        buffer += " ON CONFLICT (";
+        for (std::size_t index = 0; index < conflictKeys_.size(); index++)
+        {
+          buffer += (index == 0) ? "" : ", ";
+          buffer += conflictKeys_[index];
+        };
+        buffer += ')';
+        if (updates)
+        {
+          buffer += " DO UPDATE SET ";
+          appendUpdates("", "EXCLUDED.", "");
+        }
+        else
+        {
+          buffer += " DO NOTHING";
+        };
+        break;
+      }
+      case MICROSOFT:
+      case ORACLE:
+      {
+        bool firstValue = true;
+
+        if (dialect == MICROSOFT)
+        {
+          buffer += ") AS SRC (";
+          appendColumns("");
+          buffer += ')';
+        }
+        else
+        {
+          buffer += ") SRC";
+        };
+
+        buffer += " ON (";
+        for (auto const &key : conflictKeys_)
         {
           if (firstValue)
           {
@@ -1059,46 +2992,89 @@ namespace GCL
           }
           else
           {
-            fieldValues += ", ";
+            buffer += " AND ";
           };
-          fieldValues+= getColumnMappedName(element.first) + " = ";
-
-          fieldValues += preparedStatement_ ? "?" : to_string(element.second);
+          buffer += "TGT.";
+          buffer += key;
+          buffer += " = SRC.";
+          buffer += key;
         };
+        buffer += ')';
 
-        returnValue += fieldValues;
+        if (updates)
+        {
+          buffer += " WHEN MATCHED THEN UPDATE SET ";
+          appendUpdates("TGT.", "SRC.", "");
+        };
+        buffer += " WHEN NOT MATCHED THEN INSERT (";
+        appendColumns("");
+        buffer += ") VALUES (";
+        appendColumns("SRC.");
+        buffer += ')';
 
+        if (dialect == MICROSOFT)
+        {
+          buffer += ';';        // MICROSOFT requires MERGE to be terminated.
+        };
         break;
       }
-      default:
+    };
+  }
+
+  /// @brief      Appends one row of an upsert query. ORACLE has no row constructor, so each row is a SELECT from DUAL with the
+  ///             column names as aliases.
+  /// @param[out] buffer: The buffer to append the row to.
+  /// @param[in]  row: The row values, one per column. Not used by prepared statements, which render placeholders.
+  /// @throws     std::out_of_range
+  /// @version    2026-10-16/GGB - Function created.
+
+  void sqlWriter::appendUpsertRow(std::string &buffer, parameterVector_t const &row) const
+  {
+    buffer += (dialect == ORACLE) ? "SELECT " : "(";
+
+    for (std::size_t index = 0; index < selectFields.size(); index++)
+    {
+      if (index != 0)
       {
-        CODE_ERROR();
+        buffer += ", ";
+      };
+
+      if (preparedStatement_)
+      {
+        buffer += '?';
       }
+      else
+      {
+        appendTo(buffer, row.at(index));
+      };
+
+      if (dialect == ORACLE)
+      {
+        buffer += ' ';
+        appendTo(buffer, selectFields[index]);
+      };
     };
 
-    return returnValue;
+    buffer += (dialect == ORACLE) ? " FROM DUAL" : ")";
   }
 
   /// @brief      Converts the where clause to a string for creating the SQL string.
+  /// @param[out] buffer: The buffer to append the clause to.
   /// @param[in]  preparedQuery: true if the quewry should be a prepared query.
-  /// @returns    The where clause.
   /// @throws
+  /// @version    2026-10-16/GGB - Changed to append to a buffer rather than returning a string. Removed function tracing from the
+  ///                              rendering path.
   /// @version    2022-06-02/GGB - Added support for 'IN'
   /// @version    2021-11-18/GGB - Updated to use std::variant with the where fields.
   /// @version    2015-05-24/GGB - Function created.
 
-  std::string sqlWriter::createWhereClause(bool preparedQuery) const
+  void sqlWriter::createWhereClause(std::string &buffer, bool) const
   {
-    logger::TRACE_ENTER();
-    std::string returnValue = "";
-
     if (!std::holds_alternative<std::monostate>(whereClause_.base))
     {
-      returnValue += " WHERE " + to_string(whereClause_);
+      buffer += " WHERE ";
+      appendTo(buffer, whereClause_);
     }
-
-    logger::TRACE_EXIT();
-    return returnValue;
   }
 
   /// @brief Adds the distinct keyword to a select query.
@@ -1141,29 +3117,56 @@ namespace GCL
     return *this;
   }
 
-  /// @brief        Searches the databaseMap and determines the mapped column names.
-  /// @param[in]    columnName: The columnName to map.
-  /// @returns      The mapped column name,
-  /// @throws       None.
-  /// @version
-  /// @todo         Implement this function. (Bug# 0000193)
+  /// @brief      Adds a sub-query to the from clause. The sub-query node is allocated from the arena if there is one.
+  /// @param[in]  subQuery: The sub-query.
+  /// @param[in]  alias: The alias to use for the sub-query.
+  /// @returns    (*this)
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-16/GGB - Function created.
 
-  std::string sqlWriter::getColumnMappedName(std::string const &columnName) const
+  sqlWriter &sqlWriter::from(sqlWriter &&subQuery, std::optional<std::string> alias)
   {
-    std::string returnValue = columnName;
+    fromFields.emplace_back(makeNode<sqlWriter>(std::move(subQuery)), alias);
 
-    return returnValue;
+    return *this;
   }
 
-  /// @brief  Return the mapped table name.
-    /// @todo Implement the getTableMap function. (Bug# 0000194)
+  /// @brief      Sets the table/column map snapshot. Use this to share one loaded map between many sqlWriter instances.
+  ///             @code query.databaseMap(templateQuery.databaseMap()); @endcode
+  /// @param[in]  map: The snapshot. May be nullptr for no mapping.
+  /// @returns    (*this)
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
+
+  sqlWriter &sqlWriter::databaseMap(std::shared_ptr<sqlDatabaseMap const> map) noexcept
+  {
+    databaseMap_ = std::move(map);
+    return *this;
+  }
 
-    std::string sqlWriter::getTableMappedName(std::string const &search) const
-    {
-      std::string returnValue = search;
+  /// @brief        Searches the databaseMap and determines the mapped column names.
+  /// @note         Queries are rendered with the names as given. The map is not applied when rendering.
+  /// @param[in]    columnName: The columnName to map. May be qualified. (table.column)
+  /// @returns      The mapped column name. If the column is not mapped, a view of columnName.
+  /// @throws       None.
+  /// @version      2026-10-16/GGB - Implemented using the shared sqlDatabaseMap snapshot. (Bug# 0000193)
 
-      return returnValue;
-    }
+  std::string_view sqlWriter::getColumnMappedName(std::string const &columnName) const noexcept
+  {
+    return databaseMap_ ? databaseMap_->columnName(columnName) : std::string_view(columnName);
+  }
+
+  /// @brief        Return the mapped table name.
+  /// @note         Queries are rendered with the names as given. The map is not applied when rendering.
+  /// @param[in]    search: The table name to map.
+  /// @returns      The mapped table name. If the table is not mapped, a view of search.
+  /// @throws       None.
+  /// @version      2026-10-16/GGB - Implemented using the shared sqlDatabaseMap snapshot. (Bug# 0000194)
+
+  std::string_view sqlWriter::getTableMappedName(std::string const &search) const noexcept
+  {
+    return databaseMap_ ? databaseMap_->tableName(search) : std::string_view(search);
+  }
 
   /// @brief      Determines if the stored query has any bind values.
   /// @returns    true - if there are bind values.
@@ -1208,6 +3211,10 @@ namespace GCL
             returnValue = returnValue || std::holds_alternative<bindValue_t>(parameter.second);
           }
         }
+        if (!returnValue && (queryType == qt_upsert) && std::holds_alternative<valueStorage_t>(insertValue))
+        {
+          returnValue = hasBindValues(std::get<valueStorage_t>(insertValue));
+        };
         break;
       }
       case qt_insert:
@@ -1345,6 +3352,7 @@ namespace GCL
       [&](std::monostate const &) { CODE_ERROR(); },
       [&](valueStorage_t const &vs) { returnValue = hasBindValues(vs); },
       [&](pointer_t const &pt) { returnValue = pt->hasBindValues(); },
+      [&](columnStorage_t const &) { returnValue = false; },
     }, vt);
 
     return returnValue;
@@ -1416,13 +3424,15 @@ namespace GCL
   /// @returns    true - column added.
   /// @returns    false - column no added.
   /// @throws     None.
+  /// @version    2026-10-16/GGB - The change is published as a new sqlDatabaseMap snapshot.
   /// @version    2013-01-26/GGB - Function created.
 
   bool sqlWriter::createColumn(std::string const &tableName, std::string const &columnName)
   {
+    TDatabaseMap definition = databaseMap_ ? databaseMap_->definition() : TDatabaseMap();
     TDatabaseMap::iterator iter;
 
-    if ( (iter = databaseMap.find(tableName)) == databaseMap.end() )
+    if ( (iter = definition.find(tableName)) == definition.end() )
     {
       return false;
     }
@@ -1436,6 +3446,7 @@ namespace GCL
       columnData.columnName.first = columnName;
 
       (*iter).second.columnData[columnName] = columnData;
+      databaseMap_ = std::make_shared<sqlDatabaseMap const>(std::move(definition));
       return true;
     };
   }
@@ -1444,22 +3455,25 @@ namespace GCL
   /// @param[in] tableName: The table name.
   /// @returns true =
   /// @note The table is not yet mapped at this point.
+  /// @version 2026-10-16/GGB - The change is published as a new sqlDatabaseMap snapshot.
   /// @version 2013-01-26/GGB - Function created.
 
   bool sqlWriter::createTable(std::string const &tableName)
   {
     // Check if the table already exists in the database.
 
-    if ( (databaseMap.find(tableName) != databaseMap.end()) )
+    if ( databaseMap_ && (databaseMap_->definition().find(tableName) != databaseMap_->definition().end()) )
     {
       return false;
     }
     else
     {
+      TDatabaseMap definition = databaseMap_ ? databaseMap_->definition() : TDatabaseMap();
       STableData newTable;
       newTable.tableName.first = tableName;
 
-      databaseMap[tableName] = newTable;
+      definition[tableName] = newTable;
+      databaseMap_ = std::make_shared<sqlDatabaseMap const>(std::move(definition));
       return true;
     };
   }
@@ -1469,48 +3483,104 @@ namespace GCL
   /// @param[in] columnName: The column name to map.
   /// @param[in] columnMap: The columnName to use when referring to the columnName.
   /// @throws None.
+  /// @version 2026-10-16/GGB - The change is published as a new sqlDatabaseMap snapshot.
   /// @version 2013-01-26/GGB - Function created.
 
   void sqlWriter::setColumnMap(std::string const &tableName, std::string const &columnName, std::string const &columnMap)
   {
-    if ( databaseMap.find(tableName) != databaseMap.end() )
+    if (databaseMap_)
     {
-      if ( databaseMap[tableName].columnData.find(columnName) != databaseMap[tableName].columnData.end() )
+      TDatabaseMap definition = databaseMap_->definition();
+
+      if (setColumnMap(definition, tableName, columnName, columnMap))
       {
-        databaseMap[tableName].columnData[columnName].columnName.first = columnName;
-        databaseMap[tableName].columnData[columnName].columnName.second = columnMap;
+        databaseMap_ = std::make_shared<sqlDatabaseMap const>(std::move(definition));
       };
     };
   }
 
+  /// @brief      Sets the mapping of a column in a database map definition.
+  /// @param[in,out] definition: The definition to change.
+  /// @param[in]  tableName: The table name having the column.
+  /// @param[in]  columnName: The column name to map.
+  /// @param[in]  columnMap: The columnName to use when referring to the columnName.
+  /// @returns    true if the column exists and was mapped.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
+
+  bool sqlWriter::setColumnMap(TDatabaseMap &definition, std::string const &tableName, std::string const &columnName,
+                               std::string const &columnMap)
+  {
+    bool returnValue = false;
+    TDatabaseMap::iterator tableIter;
+    TColumnMap::iterator columnIter;
+
+    if ( ((tableIter = definition.find(tableName)) != definition.end()) &&
+         ((columnIter = tableIter->second.columnData.find(columnName)) != tableIter->second.columnData.end()) )
+    {
+      columnIter->second.columnName.first = columnName;
+      columnIter->second.columnName.second = columnMap;
+      returnValue = true;
+    };
+
+    return returnValue;
+  }
+
   /// @brief Sets the Mapping of the table.
   /// @param[in] tableName: The name of the table.
   /// @param[in] tableMap: The string to map to the tableName.
+  /// @version 2026-10-16/GGB - The change is published as a new sqlDatabaseMap snapshot.
   /// @version 2013-01-26/GGB - Function created.
 
   void sqlWriter::setTableMap(std::string const &tableName, std::string const &tableMap)
   {
-    if ( databaseMap.find(tableName) != databaseMap.end() )
+    if (databaseMap_)
+    {
+      TDatabaseMap definition = databaseMap_->definition();
+
+      if (setTableMap(definition, tableName, tableMap))
+      {
+        databaseMap_ = std::make_shared<sqlDatabaseMap const>(std::move(definition));
+      };
+    };
+  }
+
+  /// @brief      Sets the mapping of a table in a database map definition.
+  /// @param[in,out] definition: The definition to change.
+  /// @param[in]  tableName: The name of the table.
+  /// @param[in]  tableMap: The string to map to the tableName.
+  /// @returns    true if the table exists and was mapped.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
+
+  bool sqlWriter::setTableMap(TDatabaseMap &definition, std::string const &tableName, std::string const &tableMap)
+  {
+    bool returnValue = false;
+    TDatabaseMap::iterator iter;
+
+    if ( (iter = definition.find(tableName)) != definition.end() )
     {
-      databaseMap[tableName].tableName.first = tableName;
-      databaseMap[tableName].tableName.second = tableMap;
+      iter->second.tableName.first = tableName;
+      iter->second.tableName.second = tableMap;
+      returnValue = true;
     };
+
+    return returnValue;
   }
 
   /// @brief Output the "FROM" clause as a string.
-  /// @returns A string representation of the "FROM" clause.
+  /// @param[out] buffer: The buffer to append the clause to.
+  /// @version 2026-10-16/GGB - Changed to append to a buffer rather than returning a string.
   /// @version 2022-09-16/GGB - Added functionality for sub-queries.
   /// @version 2016-05-08/GGB: Added support for table alisases and table maps.
   /// @version 2015-04-12/GGB: Function created.
 
-  std::string sqlWriter::createFromClause() const
+  void sqlWriter::createFromClause(std::string &buffer) const
   {
-    std::string returnValue = " FROM ";
-    std::string tableName;
     bool first = true;
-    std::vector<std::string>::const_iterator iterator;
 
-    first = true;
+    buffer += " FROM ";
+
     for (auto const &element : fromFields)
     {
       if (first)
@@ -1519,34 +3589,40 @@ namespace GCL
       }
       else
       {
-        returnValue += ", ";
+        buffer += ", ";
       };
 
       std::visit(overloaded
                  {
-                   [&](std::string const &p) { returnValue += p; },
-                   [&](pointer_t const &pt) { returnValue += "(" + static_cast<std::string>(*pt) + ")"; },
+                   [&](std::string const &p) { buffer += p; },
+                   [&](pointer_t const &pt)
+                   {
+                     buffer += '(';
+                     pt->appendTo(buffer);
+                     buffer += ')';
+                   },
                  }, std::get<0>(element));
 
       if (std::get<1>(element))
       {
-        returnValue += " AS " + *std::get<1>(element);
+        buffer += " AS ";
+        buffer += *std::get<1>(element);
       };
     }
-
-    return returnValue;
   }
 
   /// @brief Creates the 'GROUP BY' clause if required.
-  /// @returns A string containing the 'GROUP BY' clause.
+  /// @param[out] buffer: The buffer to append the clause to.
+  /// @version 2026-10-16/GGB - Changed to append to a buffer rather than returning a string.
   /// @version 2022-04-07/GGB - Function created.
 
-  std::string sqlWriter::createGroupByClause() const
+  void sqlWriter::createGroupByClause(std::string &buffer) const
   {
-    std::string returnValue = " GROUP BY ";
     bool first = true;
 
-    for (auto column : groupByFields_)
+    buffer += " GROUP BY ";
+
+    for (auto const &column : groupByFields_)
     {
       if (first)
       {
@@ -1554,44 +3630,41 @@ namespace GCL
       }
       else
       {
-        returnValue += ", ";
+        buffer += ", ";
       }
-      returnValue += to_string(column);
+      appendTo(buffer, column);
     }
-
-    return returnValue;
   }
 
   /// @brief      Creates the "JOIN" clause
-  /// @returns    A string containing the join clause (begins with the JOIN keyword.
+  /// @param[out] buffer: The buffer to append the join clause (begins with the JOIN keyword) to.
+  /// @version    2026-10-16/GGB - Changed to append to a buffer rather than returning a string.
   /// @version    2017-07-29/GGB - Function created.
 
-  std::string sqlWriter::createJoinClause() const
+  void sqlWriter::createJoinClause(std::string &buffer) const
   {
-    std::string returnValue;
-
-    for (auto element : joinFields)
+    for (auto const &element : joinFields)
     {
       switch (std::get<2>(element))
       {
         case JOIN_LEFT:
         {
-          returnValue += + " LEFT JOIN ";
+          buffer += " LEFT JOIN ";
           break;
         };
         case JOIN_RIGHT:
         {
-          returnValue += + " RIGHT JOIN ";
+          buffer += " RIGHT JOIN ";
           break;
         };
         case JOIN_INNER:
         {
-          returnValue += " INNER JOIN ";
+          buffer += " INNER JOIN ";
           break;
         }
         case JOIN_FULL:
         {
-          returnValue += "FULL JOIN ";
+          buffer += "FULL JOIN ";
           break;
         }
         default:
@@ -1601,26 +3674,32 @@ namespace GCL
         }
 
       };
-      returnValue += std::get<3>(element).tableDefinition() + " ON ";
-      returnValue += std::get<0>(element) + "." + std::get<1>(element) + "=" + std::get<3>(element).table() + "." + std::get<4>(element);
+      buffer += std::get<3>(element).tableDefinition();
+      buffer += " ON ";
+      buffer += std::get<0>(element);
+      buffer += '.';
+      buffer += std::get<1>(element);
+      buffer += '=';
+      buffer += std::get<3>(element).table();
+      buffer += '.';
+      buffer += std::get<4>(element);
     }
-
-    return returnValue;
   }
 
   /// @brief Creates the "ORDER BY" clause.
-  /// @returns A string representation of the "Order By" clause.
+  /// @param[out] buffer: The buffer to append the clause to.
   /// @throws None.
+  /// @version 2026-10-16/GGB - Column names are rendered as given, as for the other query types.
+  /// @version 2026-10-16/GGB - Changed to append to a buffer rather than returning a string.
   /// @version 2015-04-12/GGB - Function created.
 
-  std::string sqlWriter::createOrderByClause() const
+  void sqlWriter::createOrderByClause(std::string &buffer) const
   {
-    orderByStorage_t::const_iterator iterator;
     bool first = true;
 
-    std::string returnValue = " ORDER BY ";
+    buffer += " ORDER BY ";
 
-    for (iterator = orderByFields.begin(); iterator != orderByFields.end(); iterator++)
+    for (auto const &element : orderByFields)
     {
       if (first)
       {
@@ -1628,28 +3707,27 @@ namespace GCL
       }
       else
       {
-        returnValue += ", ";
+        buffer += ", ";
       };
-      returnValue += getColumnMappedName((*iterator).first);
-      returnValue += " ";
+      buffer += element.first;
+      buffer += ' ';
 
-      if ((*iterator).second == ASC)
+      if (element.second == ASC)
       {
-        returnValue += "ASC ";
+        buffer += "ASC ";
       }
-      else if ((*iterator).second == DESC)
+      else if (element.second == DESC)
       {
-        returnValue += "DESC ";
+        buffer += "DESC ";
       };
     };
-
-    return returnValue;
   }
 
   /// @brief    Function to create the select clause.
-  /// @returns  A string representation of the select clause.
+  /// @param[out] buffer: The buffer to append the clause to.
   /// @note     This function also performs the mapping to the correct table.columnNames. Additionally, if only the columnName is
   ///           given the function will also search the correct tableName or tableAlias and add that to the term.
+  /// @version  2026-10-16/GGB - Changed to append to a buffer rather than returning a string.
   /// @version  2022-07-23/GGB - Added support for constants as select cases.
   /// @version  2022-04-06/GGB - Added support for 'COUNT() AS '
   /// @version  2017-08-20/GGB - Added support for min() and max()
@@ -1657,21 +3735,22 @@ namespace GCL
   /// @version  2017-08-12/GGB - Added code to support COUNT() clauses.
   /// @version  2015-04-12/GGB - Function created.
 
-  std::string sqlWriter::createSelectClause() const
+  void sqlWriter::createSelectClause(std::string &buffer) const
   {
-    std::string returnValue = "SELECT ";
     bool first = true;
-    std::vector<std::string>::const_iterator iterator;
-    std::string columnName;
 
-    if ( (dialect == MICROSOFT) && (limitValue))
+    buffer += "SELECT ";
+
+    if ( (dialect == MICROSOFT) && limitValue && !offsetValue)
     {
-      returnValue += "TOP " + std::to_string(*limitValue) + " ";
+      buffer += "TOP ";
+      buffer += std::to_string(*limitValue);
+      buffer += ' ';
     };
 
     if (distinct_)
     {
-      returnValue += "DISTINCT ";
+      buffer += "DISTINCT ";
     };
 
     for (auto const &field: selectFields)
@@ -1682,11 +3761,9 @@ namespace GCL
       }
       else
       {
-        returnValue += ", ";
+        buffer += ", ";
       };
-      columnName = to_string(field);
-
-      returnValue += columnName;
+      appendTo(buffer, field);
     };
 
     if (countValue)
@@ -1697,86 +3774,86 @@ namespace GCL
       }
       else
       {
-        returnValue += ", ";
+        buffer += ", ";
       };
 
       if ((*countValue).first == "*")
       {
-        returnValue += "COUNT(*) ";
+        buffer += "COUNT(*) ";
       }
       else
       {
-        returnValue += "COUNT(" + (*countValue).first + ") ";
+        buffer += "COUNT(";
+        buffer += (*countValue).first;
+        buffer += ") ";
       };
 
       if ((*countValue).second.size() != 0)
       {
-        returnValue += " AS " + (*countValue).second;
+        buffer += " AS ";
+        buffer += (*countValue).second;
       };
     }
 
-    if (!maxFields.empty())
+    for (auto const &element : maxFields)
     {
-      for (auto element : maxFields)
+      if (first)
       {
-        if (first)
-        {
-          first = false;
-        }
-        else
-        {
-          returnValue += ", ";
-        };
-
-        returnValue += "MAX(" + element.first + ")";
-        if (!element.second.empty())
-        {
-          returnValue += " AS " + element.second;
-        };
+        first = false;
       }
-    };
+      else
+      {
+        buffer += ", ";
+      };
 
-    if (!minFields.empty())
-    {
-      for (auto element : minFields)
+      buffer += "MAX(";
+      buffer += element.first;
+      buffer += ')';
+      if (!element.second.empty())
       {
-        if (first)
-        {
-          first = false;
-        }
-        else
-        {
-          returnValue += ", ";
-        };
+        buffer += " AS ";
+        buffer += element.second;
+      };
+    }
 
-        returnValue += "MIN(" + element.first + ")";
-        if (!element.second.empty())
-        {
-          returnValue += " AS " + element.second;
-        };
+    for (auto const &element : minFields)
+    {
+      if (first)
+      {
+        first = false;
       }
-    };
+      else
+      {
+        buffer += ", ";
+      };
 
-    return returnValue;
+      buffer += "MIN(";
+      buffer += element.first;
+      buffer += ')';
+      if (!element.second.empty())
+      {
+        buffer += " AS ";
+        buffer += element.second;
+      };
+    }
   }
 
   /// @brief      Produces the string for a SELECT query.
-  /// @param[in]  preparedQuery: true if the quewry should be a prepared query.
-  /// @returns    A string containing the select clause.
+  /// @param[out] buffer: The buffer to append the query to.
   /// @throws     None.
+  /// @version    2026-10-16/GGB - Added the keyset (seek) condition.
+  /// @version    2026-10-16/GGB - Changed to append to a buffer rather than returning a string.
   /// @version    2021-04-11/GGB - Added support for "FOR SHARE" and "FOR UPDATE"
   /// @version    2020-04-25/GGB - Added support for the LIMIT and OFFSET clauses.
   /// @version    2017-08-12/GGB - Added check for countValue in selectClause if statement.
   /// @version    2015-03-30/GGB - Function created.
 
-  std::string sqlWriter::createSelectQuery() const
+  void sqlWriter::createSelectQuery(std::string &buffer) const
   {
-    std::string returnValue;
-
     if ( !selectFields.empty() || countValue ||
          !maxFields.empty() || !minFields.empty() )
     {
-      returnValue += createSelectClause();
+      createSelectClause(buffer);
     }
     else
     {
@@ -1785,7 +3862,7 @@ namespace GCL
 
     if (!fromFields.empty())
     {
-      returnValue += createFromClause();
+      createFromClause(buffer);
     }
     else
     {
@@ -1794,33 +3871,32 @@ namespace GCL
 
     if (!joinFields.empty())
     {
-      returnValue += createJoinClause();
+      createJoinClause(buffer);
     }
 
-    returnValue += createWhereClause();
+    createWhereClause(buffer);
+    createSeekClause(buffer);
 
     if (!groupByFields_.empty())
     {
-      returnValue += createGroupByClause();
+      createGroupByClause(buffer);
     };
 
     if (!orderByFields.empty())
     {
-      returnValue += createOrderByClause();
+      createOrderByClause(buffer);
     };
 
-    returnValue += createLimitClause();
+    createLimitClause(buffer);
 
     if (forShare_)
     {
-      returnValue += " FOR SHARE";
+      buffer += " FOR SHARE";
     }
     else if (forUpdate_)
     {
-      returnValue += " FOR UPDATE";
+      buffer += " FOR UPDATE";
     };
-
-    return returnValue;
   }
 
   /// @brief Constructor for the from clause.
@@ -1896,22 +3972,352 @@ namespace GCL
       groupByFields_.push_back(column);
     }
 
-    return *this;
+    return *this;
+  }
+
+  /// @brief  Add a group of group by columns.
+  /// @param[in] column: The column name.
+  /// @returns *this;
+  /// @version 2022-04-07/GGB - Function created.
+
+  sqlWriter &sqlWriter::groupBy(std::initializer_list<columnNumber_t> columns)
+  {
+    for (auto column: columns)
+    {
+      groupByFields_.push_back(column);
+    }
+
+    return *this;
+  }
+
+  /// @brief      Sets how IN/NOT IN lists with more than threshold values are rendered. Shorter lists are always rendered as
+  ///             col IN (a, b, ...). @code query.inList(sqlWriter::IN_CHUNKED, 1000, 500); @endcode
+  /// @param[in]  strategy: The strategy for long lists. IN_AUTO chooses by dialect.
+  /// @param[in]  threshold: The longest list that is rendered as a plain list. Zero applies the strategy to every list.
+  /// @param[in]  chunkSize: The number of values in each group for IN_CHUNKED, and the number of rows in each insert for
+  ///             IN_TEMP_TABLE.
+  /// @returns    *this
+  /// @throws     GCL::CRuntimeAssert
+  /// @note       IN_ANY is only available for POSTGRE and lists without bind values. IN_VALUES is used instead.
+  ///             IN_VALUES is not available for ORACLE. IN_CHUNKED is used instead.
+  /// @version    2026-10-16/GGB - Function created.
+
+  sqlWriter &sqlWriter::inList(EInList strategy, std::size_t threshold, std::size_t chunkSize)
+  {
+    RUNTIME_ASSERT(chunkSize != 0, boost::locale::translate("The IN list chunk size must not be zero."));
+
+    inList_ = strategy;
+    inListThreshold_ = threshold;
+    inListChunk_ = chunkSize;
+
+    return *this;
+  }
+
+  /// @brief      Returns the SQL type of the column of an IN list temporary table.
+  /// @param[in]  p: A value from the list.
+  /// @param[in]  width: The length of the longest string in the list.
+  /// @returns    The column type.
+  /// @throws     GCL::runtime_error
+  /// @version    2026-10-16/GGB - Function created.
+
+  std::string sqlWriter::inListColumnType(parameter_t const &p, std::size_t width) const
+  {
+    std::string returnValue;
+
+    if (std::holds_alternative<bindValue_t>(p))
+    {
+      RUNTIME_ERROR(boost::locale::translate("An IN list temporary table cannot be created for bind values."));
+    };
+
+    switch (parameterType(p))
+    {
+      case PT_U64:
+      {
+        returnValue = (dialect == ORACLE) ? "NUMBER(20)" : "DECIMAL(20)";
+        break;
+      };
+      case PT_FLOAT:
+      case PT_DOUBLE:
+      {
+        switch (dialect)
+        {
+          case POSTGRE: returnValue = "DOUBLE PRECISION"; break;
+          case MICROSOFT: returnValue = "FLOAT"; break;
+          case ORACLE: returnValue = "BINARY_DOUBLE"; break;
+          default: returnValue = "DOUBLE"; break;
+        };
+        break;
+      };
+      case PT_DATE:
+      {
+        returnValue = "DATE";
+        break;
+      };
+      case PT_TIME:
+      {
+        returnValue = (dialect == ORACLE) ? "VARCHAR2(8)" : "TIME";
+        break;
+      };
+      case PT_DATETIME:
+      {
+        switch (dialect)
+        {
+          case MYSQL: returnValue = "DATETIME"; break;
+          case MICROSOFT: returnValue = "DATETIME2"; break;
+          default: returnValue = "TIMESTAMP"; break;
+        };
+        break;
+      };
+      case PT_DECIMAL:
+      {
+        switch (dialect)
+        {
+          case MYSQL: returnValue = "DECIMAL(65, 30)"; break;
+          case MICROSOFT: returnValue = "DECIMAL(38, 18)"; break;
+          case ORACLE: returnValue = "NUMBER"; break;
+          default: returnValue = "NUMERIC"; break;
+        };
+        break;
+      };
+      case PT_STRING:
+      {
+        switch (dialect)
+        {
+          case POSTGRE: returnValue = "TEXT"; break;
+          case MICROSOFT: returnValue = "NVARCHAR(" + std::to_string(width) + ")"; break;
+          case ORACLE: returnValue = "VARCHAR2(" + std::to_string(width) + ")"; break;
+          default: returnValue = "VARCHAR(" + std::to_string(width) + ")"; break;
+        };
+        break;
+      };
+      default:
+      {
+        returnValue = (dialect == ORACLE) ? "NUMBER(19)" : "BIGINT";
+        break;
+      };
+    };
+
+    return returnValue;
+  }
+
+  /// @brief      Creates the statements that load the temporary tables used by IN_TEMP_TABLE lists. The statements must be
+  ///             executed in order, on the same connection, before the query. Lists in sub-queries are included.
+  /// @param[in]  sink: Called with each statement and the number of rows inserted by the statement.
+  /// @returns    The number of temporary tables.
+  /// @throws     GCL::runtime_error
+  /// @note       Each table is dropped (if it exists) and created. ORACLE uses private temporary tables that are dropped at
+  ///             the end of the transaction, so the query must be executed in the same transaction.
+  /// @note       The table is named for the column. (tmp_in_column) A query can only have one IN_TEMP_TABLE list for each
+  ///             column.
+  /// @version    2026-10-16/GGB - Function created.
+
+  std::size_t sqlWriter::inListSetup(statementSink_t const &sink) const
+  {
+    std::size_t returnValue = 0;
+
+    for (auto const &element : fromFields)
+    {
+      if (std::holds_alternative<pointer_t>(std::get<0>(element)))
+      {
+        returnValue += std::get<pointer_t>(std::get<0>(element))->inListSetup(sink);
+      };
+    };
+    inListSetup(sink, whereClause_, returnValue);
+
+    return returnValue;
+  }
+
+  /// @brief      Creates the statements that load the temporary tables used by the IN_TEMP_TABLE lists of a where clause.
+  /// @param[in]  sink: Called with each statement and the number of rows inserted by the statement.
+  /// @param[in]  wv: The where clause.
+  /// @param[in,out] count: The number of temporary tables.
+  /// @throws     GCL::runtime_error
+  /// @version    2026-10-16/GGB - Function created.
+
+  void sqlWriter::inListSetup(statementSink_t const &sink, whereVariant_t const &wv, std::size_t &count) const
+  {
+    auto const load = [&](std::string const &column, auto const &pc)
+    {
+      std::string const table = inListTable(column);
+      std::string statement;
+      std::size_t width = 1;
+      auto iter = pc.begin();
+      sqlWriter loader;
+
+      for (auto const &p : pc)
+      {
+        if (std::holds_alternative<std::string>(p))
+        {
+          width = std::max(width, std::get<std::string>(p).size());
+        };
+      };
+
+      switch (dialect)
+      {
+        case MYSQL:
+        {
+          statement = "DROP TEMPORARY TABLE IF EXISTS " + table;
+          break;
+        };
+        case ORACLE:
+        {
+          break;
+        };
+        default:
+        {
+          statement = "DROP TABLE IF EXISTS " + table;
+          break;
+        };
+      };
+      if (!statement.empty())
+      {
+        sink(statement, 0);
+      };
+
+      switch (dialect)
+      {
+        case ORACLE: statement = "CREATE PRIVATE TEMPORARY TABLE "; break;
+        case MICROSOFT: statement = "CREATE TABLE "; break;
+        default: statement = "CREATE TEMPORARY TABLE "; break;
+      };
+      statement += table;
+      statement += " (v ";
+      statement += inListColumnType(*pc.begin(), width);
+      statement += ')';
+      if (dialect == ORACLE)
+      {
+        statement += " ON COMMIT DROP DEFINITION";
+      };
+      sink(statement, 0);
+
+      loader.setDialect(dialect);
+      loader.insertInto(table, {"v"});
+      loader.insertStream([&](parameterVector_t &row)
+                          {
+                            bool returnValue = false;
+
+                            if (iter != pc.end())
+                            {
+                              row[0] = *iter;
+                              ++iter;
+                              returnValue = true;
+                            };
+                            return returnValue;
+                          }, sink, inListChunk_);
+      count++;
+    };
+
+    std::visit(overloaded
+    {
+      [&](std::monostate const &) { },
+      [&](whereTest_t const &wt)
+      {
+        if (std::holds_alternative<pointer_t>(std::get<2>(wt)))
+        {
+          count += std::get<pointer_t>(std::get<2>(wt))->inListSetup(sink);
+        }
+        else if (inListStrategy(wt) == IN_TEMP_TABLE)
+        {
+          std::visit(overloaded
+          {
+            [&](parameterVector_t const &pv) { load(std::get<0>(wt), pv); },
+            [&](parameterSet_t const &ps) { load(std::get<0>(wt), ps); },
+            [&](auto const &) { CODE_ERROR(); },
+          }, std::get<2>(wt));
+        };
+      },
+      [&](whereLogical_t const &wl)
+      {
+        inListSetup(sink, *std::get<0>(wl), count);
+        inListSetup(sink, *std::get<2>(wl), count);
+      },
+    }, wv.base);
+  }
+
+  /// @brief      Determines how an IN/NOT IN test is rendered.
+  /// @param[in]  wt: The where test.
+  /// @returns    The strategy. IN_LIST for other tests and for lists that are not longer than the threshold.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
+
+  sqlWriter::EInList sqlWriter::inListStrategy(whereTest_t const &wt) const
+  {
+    EInList returnValue = IN_LIST;
+    std::size_t size = 0;
+    bool bindValues = false;
+
+    if ((std::get<1>(wt) == in) || (std::get<1>(wt) == nin))
+    {
+      std::visit(overloaded
+      {
+        [&](parameterVector_t const &pv) { size = pv.size(); },
+        [&](parameterSet_t const &ps) { size = ps.size(); },
+        [&](auto const &) { },
+      }, std::get<2>(wt));
+    };
+
+    if (size > inListThreshold_)
+    {
+      returnValue = inList_;
+      if (returnValue == IN_AUTO)
+      {
+        switch (dialect)
+        {
+          case POSTGRE: returnValue = IN_ANY; break;
+          case MICROSOFT: returnValue = IN_VALUES; break;
+          case ORACLE: returnValue = IN_CHUNKED; break;
+          default: returnValue = IN_LIST; break;      // MYSQL searches a constant IN list with a binary search.
+        };
+      };
+
+      if (returnValue == IN_ANY)
+      {
+        std::visit(overloaded
+        {
+          [&](parameterVector_t const &pv) { bindValues = containsBindValue(pv); },
+          [&](parameterSet_t const &ps) { bindValues = containsBindValue(ps); },
+          [&](auto const &) { },
+        }, std::get<2>(wt));
+
+        if ((dialect != POSTGRE) || bindValues)
+        {
+          returnValue = IN_VALUES;    // A bind value cannot be placed in an array.
+        };
+      };
+      if ((returnValue == IN_VALUES) && (dialect == ORACLE))
+      {
+        returnValue = IN_CHUNKED;
+      };
+    };
+
+    return returnValue;
   }
 
-  /// @brief  Add a group of group by columns.
-  /// @param[in] column: The column name.
-  /// @returns *this;
-  /// @version 2022-04-07/GGB - Function created.
+  /// @brief      Returns the name of the temporary table for an IN_TEMP_TABLE list.
+  /// @param[in]  column: The column of the IN test.
+  /// @returns    The table name.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-16/GGB - Function created.
 
-  sqlWriter &sqlWriter::groupBy(std::initializer_list<columnNumber_t> columns)
+  std::string sqlWriter::inListTable(std::string const &column) const
   {
-    for (auto column: columns)
+    std::string returnValue;
+
+    switch (dialect)
     {
-      groupByFields_.push_back(column);
-    }
+      case MICROSOFT: returnValue = "#tmp_in_"; break;
+      case ORACLE: returnValue = "ORA$PTT_in_"; break;
+      default: returnValue = "tmp_in_"; break;
+    };
 
-    return *this;
+    for (char c : column)
+    {
+      bool const valid = ((c >= '0') && (c <= '9')) || ((c >= 'A') && (c <= 'Z')) || ((c >= 'a') && (c <= 'z'));
+
+      returnValue += valid ? c : '_';
+    };
+
+    return returnValue;
   }
 
   /// @brief      Set the query type to a 'INSERT' query.
@@ -1961,6 +4367,155 @@ namespace GCL
     return *this;
   }
 
+  /// @brief      Streams rows into a sequence of multi-row INSERT or upsert statements. The query must be an insert or upsert
+  ///             query with the columns defined. (insertInto(table, {columns}) or upsert(table, {columns})) Any values already
+  ///             in the query are ignored.
+  /// @param[in]  source: Called to fetch each row. The row vector has one element per column and is re-used between calls.
+  ///             The source assigns the values and returns false when there are no more rows.
+  /// @param[in]  sink: Called with each completed statement and the number of rows in the statement. The text is only valid
+  ///             until the sink returns.
+  /// @param[in]  maxRows: The maximum number of rows in a statement. Zero for no limit.
+  /// @param[in]  maxBytes: The maximum length of a statement in bytes, including the RETURNING clause or the upsert tail. Zero
+  ///             for no limit. A single row that exceeds the limit is emitted as a statement on its own.
+  /// @returns    The total number of rows.
+  /// @throws     GCL::CRuntimeAssert
+  /// @note       The statement and row buffers are re-used between statements. Memory use is bounded by the chunk size, not by
+  ///             the number of rows.
+  /// @note       ORACLE does not accept multi-row VALUES lists. ORACLE inserts are rendered as
+  ///             INSERT ALL INTO table (columns) VALUES (...) INTO ... SELECT 1 FROM DUAL. INSERT ALL does not support a
+  ///             RETURNING clause.
+  /// @version    2026-10-16/GGB - ORACLE inserts are rendered as INSERT ALL.
+  /// @version    2026-10-16/GGB - The length of the tail is included in the maxBytes test.
+  /// @version    2026-10-16/GGB - Added upsert queries.
+  /// @version    2026-10-16/GGB - Function created.
+
+  std::size_t sqlWriter::insertStream(rowSource_t const &source, statementSink_t const &sink,
+                                      std::size_t maxRows, std::size_t maxBytes) const
+  {
+    RUNTIME_ASSERT((queryType == qt_insert) || (queryType == qt_upsert),
+                   boost::locale::translate("insertStream() requires an insert or upsert query."));
+    RUNTIME_ASSERT(!selectFields.empty(), boost::locale::translate("insertStream() requires the insert columns."));
+    RUNTIME_ASSERT(!preparedStatement_, boost::locale::translate("insertStream() renders literal values."));
+
+    bool const insertAll = (queryType == qt_insert) && (dialect == ORACLE);
+
+    RUNTIME_ASSERT(!insertAll || returningFields_.empty(),
+                   boost::locale::translate("ORACLE INSERT ALL does not support a RETURNING clause."));
+
+    std::string statement;
+    std::string rowText;
+    parameterVector_t row(selectFields.size());
+    std::size_t headLength;
+    std::size_t tailLength;
+    std::size_t chunkRows = 0;
+    std::size_t totalRows = 0;
+    std::string_view const separator = (dialect != ORACLE) ? ", " : (queryType == qt_upsert) ? " UNION ALL " : " ";
+
+    if (queryType == qt_upsert)
+    {
+      createUpsertHead(statement);
+    }
+    else if (insertAll)
+    {
+      statement += "INSERT ALL ";
+    }
+    else
+    {
+      createInsertHead(statement);
+      statement += "VALUES ";
+    };
+    headLength = statement.size();
+
+    auto const appendTail = [&]()
+    {
+      if (queryType == qt_upsert)
+      {
+        createUpsertTail(statement);
+      }
+      else if (insertAll)
+      {
+        statement += " SELECT 1 FROM DUAL";
+      }
+      else
+      {
+        createReturningClause(statement);
+      };
+    };
+
+    auto const emit = [&]()
+    {
+      appendTail();
+      sink(statement, chunkRows);
+      statement.resize(headLength);
+      chunkRows = 0;
+    };
+
+      // The tail does not depend on the rows. It is measured once.
+
+    appendTail();
+    tailLength = statement.size() - headLength;
+    statement.resize(headLength);
+
+    while (source(row))
+    {
+      RUNTIME_ASSERT(row.size() == selectFields.size(), boost::locale::translate("Row size does not match the column count."));
+
+      rowText.clear();
+      if (queryType == qt_upsert)
+      {
+        appendUpsertRow(rowText, row);
+      }
+      else
+      {
+        if (insertAll)
+        {
+          createIntoClause(rowText);
+          rowText += "VALUES ";
+        };
+        rowText += '(';
+        appendList(rowText, row);
+        rowText += ')';
+      };
+
+      if ( (chunkRows != 0) && (maxBytes != 0) && (statement.size() + separator.size() + rowText.size() + tailLength > maxBytes) )
+      {
+        emit();
+      };
+
+      if (chunkRows != 0)
+      {
+        statement += separator;
+      };
+      statement += rowText;
+      chunkRows++;
+      totalRows++;
+
+      if ( (maxRows != 0) && (chunkRows == maxRows) )
+      {
+        emit();
+      };
+    };
+
+    if (chunkRows != 0)
+    {
+      emit();
+    };
+
+    return totalRows;
+  }
+
+  /// @brief      Determines if an upsert column is one of the conflict keys.
+  /// @param[in]  column: The column.
+  /// @returns    true if the column is a conflict key.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
+
+  bool sqlWriter::isConflictKey(selectExpression_t const &column) const
+  {
+    return std::holds_alternative<std::string>(column) &&
+           (std::find(conflictKeys_.begin(), conflictKeys_.end(), std::get<std::string>(column)) != conflictKeys_.end());
+  }
+
   /// @brief      Adds join statements to the query.
   /// @param[in]  fields: The join statements to add.
   /// @returns    (*this)
@@ -1989,6 +4544,21 @@ namespace GCL
     return (*this);
   }
 
+  /// @brief      Sets the conflict keys of an upsert query. These are the columns of the unique key that identifies an existing
+  ///             row. The conflict keys are not updated.
+  /// @param[in]  keys: The conflict key columns. Each key must also be an upsert column.
+  /// @returns    (*this)
+  /// @throws     std::bad_alloc
+  /// @note       Required for POSTGRE, ORACLE and MICROSOFT. MYSQL uses the unique keys of the table.
+  /// @version    2026-10-16/GGB - Function created.
+
+  sqlWriter &sqlWriter::onConflict(std::initializer_list<std::string> keys)
+  {
+    conflictKeys_.assign(keys.begin(), keys.end());
+
+    return *this;
+  }
+
   /// @brief  Sets the offset value. This will be interpreted based on the SQL dialect in use.
   /// @param[in] offset: The offset of the first record to return.
   /// @version 2020-04-25/GGB - Function created.
@@ -2034,6 +4604,7 @@ namespace GCL
   /// @brief      Function to load a map file and store all the aliases.
   /// @param[in]  ifn: The file to read the database mapping from.
   /// @throws     GCL::CRuntimeError
+  /// @version    2026-10-16/GGB - The mapping is built locally and published as a single new snapshot.
   /// @version    2022-04-11/GGB - Converted to std::filesystem.
   /// @version    2013-01-26/GGB - Function created.
 
@@ -2046,6 +4617,7 @@ namespace GCL
     std::string currentTable;
     size_t spacePosn, token1S, token1E, token2S, token2E, equalPosn;
     std::string szToken1, szToken2;
+    TDatabaseMap definition = databaseMap_ ? databaseMap_->definition() : TDatabaseMap();
 
     ifs.open(ifn);
 
@@ -2102,8 +4674,8 @@ namespace GCL
               std::clog << "Syntax command on line: " << lineNumber << " - COLUMN directive found, column name." << std::endl;
               RUNTIME_ERROR(boost::locale::translate("MAPPED SQL WRITER: Syntax Error."));
             }
-            else if ( (*databaseMap.find(currentTable)).second.columnData.find(szToken1) ==
-                      (*databaseMap.find(currentTable)).second.columnData.end())
+            else if ( (*definition.find(currentTable)).second.columnData.find(szToken1) ==
+                      (*definition.find(currentTable)).second.columnData.end())
             {
               RUNTIME_ERROR("Error in SQL map file: " + ifn.native() +
                             "Syntax command on line: " + std::to_string(lineNumber) + " - Invalid column name.");
@@ -2112,7 +4684,7 @@ namespace GCL
             {
               if (!szToken2.empty())
               {
-                setColumnMap(currentTable, szToken1, szToken2);
+                setColumnMap(definition, currentTable, szToken1, szToken2);
               };
             };
           }
@@ -2130,7 +4702,7 @@ namespace GCL
               std::clog << "Syntax command on line: " << lineNumber << " - TABLE directive found, but no table name." << std::endl;
               RUNTIME_ERROR(boost::locale::translate("MAPPED SQL WRITER: Syntax Error."));
             }
-            else if (databaseMap.find(szToken1) == databaseMap.end())
+            else if (definition.find(szToken1) == definition.end())
             {
               std::clog << "Error in SQL map file: " << ifn << std::endl;
               std::clog << "Error on line: " << lineNumber << " - Invalid Table name." << std::endl;
@@ -2141,7 +4713,7 @@ namespace GCL
               currentTable = szToken1;
               if (!szToken2.empty())
               {
-                setTableMap(currentTable, szToken2);  // Add the alias into the record.
+                setTableMap(definition, currentTable, szToken2);  // Add the alias into the record.
               };
             };
           }
@@ -2173,11 +4745,15 @@ namespace GCL
         lineNumber++;
       };
       ifs.close();
+
+      databaseMap_ = std::make_shared<sqlDatabaseMap const>(std::move(definition));
     };
   }
 
   /// @brief Resets all the fields for the query.
   /// @throws None.
+  /// @version 2026-10-16/GGB - Clears the seek keys.
+  /// @version 2026-10-16/GGB - Rewinds the arena if the query has one.
   /// @version 2022-06-02/GGB - Added support for 'IN'
   /// @version 2022-05-01/GGB - Added support for 'RETURNING'
   /// @version 2021-04-13/GGB - Added procedure call support.
@@ -2197,6 +4773,7 @@ namespace GCL
     joinFields.clear();
     limitValue.reset();
     offsetValue.reset();
+    seekKeys_.clear();
     countValue.reset();
     distinct_ = false;
     maxFields.clear();
@@ -2209,9 +4786,25 @@ namespace GCL
     procedureName_.clear();
     groupByFields_.clear();
     returningFields_.clear();
+    conflictKeys_.clear();
 
     resetValues();
     resetWhere();
+
+    if (arena_)
+    {
+        // A node that was moved out of the query still holds a reference to the arena. The arena can only be rewound if
+        // there are no such nodes, otherwise a new arena is used and the old one is freed with the last node.
+
+      if (arena_.use_count() == 1)
+      {
+        arena_->rewind();
+      }
+      else
+      {
+        arena_ = std::make_shared<sqlArena>(arenaSize_);
+      };
+    };
   }
 
   /// @brief    Resets the value clause of a query.
@@ -2269,12 +4862,18 @@ namespace GCL
     switch (queryType)
     {
       case qt_insert:
+      case qt_upsert:
       {
         if (std::holds_alternative<valueStorage_t>(insertValue))
         {
           valueStorage_t const valueStorage = std::get<valueStorage_t>(insertValue);
           rv = valueStorage.size();
         }
+        else if (std::holds_alternative<columnStorage_t>(insertValue))
+        {
+          columnStorage_t const &columns = std::get<columnStorage_t>(insertValue);
+          rv = columns.empty() ? 0 : columnLength(columns.front());
+        }
         else
         {
           CODE_ERROR();
@@ -2294,6 +4893,41 @@ namespace GCL
     return rv;
   }
 
+  /// @brief      Sets the last seen key values for keyset (seek) pagination. The next page is the rows after the keys in the
+  ///             order of the order by clause. Use limit() for the page size. The order by columns must be a unique key.
+  ///             @code query.select({"ID", "NAME"}).from("TBL").orderBy({{"NAME", ASC}, {"ID", ASC}}).limit(100);
+  ///             query.seekAfter({lastName, lastId}); @endcode
+  /// @param[in]  keys: The values of the order by columns in the last row of the previous page. Empty for the first page.
+  /// @returns    (*this)
+  /// @throws     None.
+  /// @note       In a prepared statement the keys are placeholders, so every page after the first has the same text. The keys
+  ///             are bound by bindValues() and compile().
+  /// @version    2026-10-16/GGB - Function created.
+
+  sqlWriter &sqlWriter::seekAfter(parameterVector_t keys)
+  {
+    seekKeys_ = std::move(keys);
+
+    return *this;
+  }
+
+  /// @brief      Determines if the seek condition is written as a row value comparison.
+  /// @returns    true if the dialect supports row value comparisons and all the order by columns have the same direction.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
+
+  bool sqlWriter::seekRowValue() const noexcept
+  {
+    bool returnValue = (dialect == MYSQL) || (dialect == POSTGRE);
+
+    for (auto const &element : orderByFields)
+    {
+      returnValue = returnValue && (element.second == orderByFields.front().second);
+    };
+
+    return returnValue;
+  }
+
   /// @brief      Specify the selection fields for the select query.
   /// @param[in]  fields: The fields to add to the select clause.
   /// @returns    A reference to (*this)
@@ -2349,47 +4983,74 @@ namespace GCL
     return *this;
   }
 
-  /// @brief      Converts the query into an SQL query string.
-  /// @returns    The SQL query as a string.
+  /// @brief      Appends the SQL query to the output buffer.
+  /// @details    All clauses, sub-queries and literals are written directly into the buffer. The buffer is not cleared before
+  ///             writing. This allows the caller to re-use a buffer (and its allocated capacity) for a number of queries.
+  /// @param[out] buffer: The buffer to append the query to.
   /// @throws     None.
+  /// @version    2026-10-16/GGB - Prepared statements are served from the statement cache when it is enabled.
+  /// @version    2026-10-16/GGB - Changed to append to a buffer. Function renamed from string().
   /// @version    2021-04-13/GGB - Added stored procedure calls.
   /// @version    2019-12-08/GGB - Added UPSERT query.
   /// @version    2017-08-12/GGB - Function created.
 
-  std::string sqlWriter::string() const
+  void sqlWriter::appendTo(std::string &buffer) const
   {
-    std::string returnValue;
+    if (preparedStatement_ && statementCache().enabled())
+    {
+      std::uint64_t const key = shapeKey();
+
+      if (!statementCache().lookup(key, buffer))
+      {
+        std::size_t const start = buffer.size();
 
+        renderQuery(buffer);
+        statementCache().insert(key, std::string_view(buffer).substr(start));
+      };
+    }
+    else
+    {
+      renderQuery(buffer);
+    };
+  }
+
+  /// @brief      Renders the query into the output buffer.
+  /// @param[out] buffer: The buffer to append the query to.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Split from appendTo() to support the statement cache.
+
+  void sqlWriter::renderQuery(std::string &buffer) const
+  {
     switch (queryType)
     {
       case qt_select:
       {
-        returnValue = createSelectQuery();
+        createSelectQuery(buffer);
         break;
       };
       case qt_insert:
       {
-        returnValue = createInsertQuery();
+        createInsertQuery(buffer);
         break;
       };
       case qt_update:
       {
-        returnValue = createUpdateQuery();
+        createUpdateQuery(buffer);
         break;
       }
       case qt_delete:
       {
-        returnValue = createDeleteQuery();
+        createDeleteQuery(buffer);
         break;
       }
       case qt_upsert:
       {
-        returnValue = createUpsertQuery();
+        createUpsertQuery(buffer);
         break;
       }
       case qt_call:
       {
-        returnValue = createCall();
+        createCall(buffer);
         break;
       }
       default:
@@ -2398,6 +5059,19 @@ namespace GCL
         break;
       };
     }
+  }
+
+  /// @brief      Converts the query into an SQL query string.
+  /// @returns    The SQL query as a string.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Changed to a wrapper around appendTo().
+  /// @version    2017-08-12/GGB - Function created.
+
+  std::string sqlWriter::string() const
+  {
+    std::string returnValue;
+
+    appendTo(returnValue);
 
     return returnValue;
   }
@@ -2461,6 +5135,10 @@ namespace GCL
             returnValue = returnValue || std::holds_alternative<std::string>(parameter.second);
           }
         }
+        if (!returnValue && (queryType == qt_upsert) && std::holds_alternative<valueStorage_t>(insertValue))
+        {
+          returnValue = shouldParameterise(std::get<valueStorage_t>(insertValue));
+        };
         break;
       }
       case qt_insert:
@@ -2601,6 +5279,11 @@ namespace GCL
       [&](std::monostate const &) { CODE_ERROR(); },
       [&](valueStorage_t const &vs) { returnValue = shouldParameterise(vs); },
       [&](pointer_t const &pt) { returnValue = pt->shouldParameterise();},
+      [&](columnStorage_t const &cs)
+      {
+        returnValue = std::any_of(cs.begin(), cs.end(),
+                                  [](column_t const &c) { return std::holds_alternative<std::span<std::string_view const>>(c); });
+      },
     }, vt);
 
     return returnValue;
@@ -2688,6 +5371,46 @@ namespace GCL
     return (*this);
   }
 
+  /// @brief      Starts a multi-row upsert query. The rows are added with values() and the conflict keys with onConflict().
+  /// @param[in]  tableName: The table to upsert.
+  /// @param[in]  fields: The columns.
+  /// @returns    (*this)
+  /// @throws     std::bad_alloc
+  /// @details @code upsert("tbl_stock", {"ItemID", "Quantity"}).values({ {1, 10}, {2, 5} }).onConflict({"ItemID"}) @endcode
+  ///          translates to (POSTGRE)
+  ///          @code INSERT INTO tbl_stock (ItemID, Quantity) VALUES (1, 10), (2, 5) ON CONFLICT (ItemID) DO UPDATE SET
+  ///                Quantity = EXCLUDED.Quantity @endcode
+  ///          Use insertStream() to split a large number of rows into several statements.
+  /// @version    2026-10-16/GGB - Function created.
+
+  sqlWriter &sqlWriter::upsert(std::string const &tableName, std::initializer_list<std::string> fields)
+  {
+    upsert(tableName);
+
+    for (auto const &field : fields)
+    {
+      selectFields.push_back(field);
+    };
+
+    return *this;
+  }
+
+  /// @brief      Allocates the query tree nodes (where clause nodes and sub-queries) from an arena owned by the query. The
+  ///             arena is rewound by resetQuery(), so a query object that is reused does not allocate nodes after the first
+  ///             use. Nodes that already exist are not moved to the arena.
+  /// @param[in]  arenaSize: The initial size of the arena. (bytes) The arena grows if the query needs more.
+  /// @returns    (*this)
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-16/GGB - Function created.
+
+  sqlWriter &sqlWriter::useArena(std::size_t arenaSize)
+  {
+    arena_ = std::make_shared<sqlArena>(arenaSize);
+    arenaSize_ = arenaSize;
+
+    return *this;
+  }
+
   /// @brief        Stores the value fields for the query.
   /// @param[in]    fields: The parameter values to include in the query.
   /// @returns      (*this)
@@ -2736,6 +5459,25 @@ namespace GCL
     return insertValue;
   }
 
+  /// @brief        Stores column-wise values. Each column is a span over the callers data. The data is not copied and must
+  ///               outlive the rendering and binding of the query.
+  /// @param[in]    columns: The columns of values. One per insert column, all of the same length.
+  /// @returns      (*this)
+  /// @throws       GCL::CRuntimeAssert
+  /// @version      2026-10-16/GGB - Function created.
+
+  sqlWriter &sqlWriter::values(columnStorage_t &&columns)
+  {
+    RUNTIME_ASSERT(columns.size() == selectFields.size(), boost::locale::translate("Column count does not match the insert columns."));
+    RUNTIME_ASSERT(std::all_of(columns.begin(), columns.end(),
+                               [&](column_t const &c) { return columnLength(c) == columnLength(columns.front()); }),
+                   boost::locale::translate("All columns must have the same length."));
+
+    insertValue = std::move(columns);
+
+    return *this;
+  }
+
   /// @brief        Stores the subquery for a INSERT INTO SELECT query.
   /// @param[in]    subQuery: The rows of values to insert.
   /// @returns      (*this)
@@ -2778,6 +5520,24 @@ namespace GCL
     return *this;
   }
 
+  /// @brief      Assigns a logical expression to the where clause. @c where(where_v("ID", eq, 1), AND, where_v("Type", eq, 2))
+  ///             The nodes are allocated from the arena if there is one.
+  /// @param[in]  lhs: The left hand side of the expression.
+  /// @param[in]  op: The logical operator.
+  /// @param[in]  rhs: The right hand side of the expression.
+  /// @returns    *this
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-16/GGB - Function created
+
+  sqlWriter &sqlWriter::where(whereVariant_t &&lhs, logicalOperator_t op, whereVariant_t &&rhs)
+  {
+    whereClause_ = whereVariant_t(whereLogical_t(makeNode<whereVariant_t>(std::move(lhs)),
+                                                 op,
+                                                 makeNode<whereVariant_t>(std::move(rhs))));
+
+    return *this;
+  }
+
   /// @brief        Returns the parameters for the passed valueStorage type.
   /// @param[in]    vs: The valueStorage value.
   /// @params[out]  The params that are created.
@@ -2810,89 +5570,119 @@ namespace GCL
     params.insert(params.end(), std::move_iterator(parameterSet.begin()), std::move_iterator(parameterSet.end()));
   }
 
+  /// @brief      Adds the parameters of a where test to the list. Long IN lists follow the strategy from inListStrategy():
+  ///               IN_ANY: The list is added as one parameter. (parameterVariant_ref) (Prepared statements only)
+  ///               IN_TEMP_TABLE: Nothing is added. The values are loaded by inListSetup().
+  ///               Other strategies: The values are added in the order they are rendered.
+  /// @param[in]  wt: The where test.
+  /// @param[out] params: The list to add the parameters to.
+  /// @throws     GCL::CCodeError
+  /// @version    2026-10-16/GGB - Long IN lists follow the IN list strategy. Strings in sets are added.
+
   void sqlWriter::to_parameter(whereTest_t &wt, std::list<bindParameter_t> &params)
   {
     FUNCTION_TRACE();
 
-    switch(std::get<1>(wt))
+    EInList const strategy = inListStrategy(wt);
+
+    if (strategy == IN_ANY)
     {
-      case eq:
-      case gt:
-      case lt:
-      case gte:
-      case lte:
-      case neq:
-      case nse:
-      case in:
-      case nin:
+      if (preparedStatement_)
       {
-        std::visit(overloaded
-         {
-           [&](parameter_t &p)
-           {
-             if (std::holds_alternative<bindValue_t>(p) || std::holds_alternative<std::string>(p))
-             {
-               params.push_back(std::ref(p));
-             }
-           },
-           [&](parameterVector_t &pv)
+        params.push_back(std::ref(std::get<2>(wt)));
+      };
+    }
+    else if (strategy == IN_TEMP_TABLE)
+    {
+        // The values are in the temporary table.
+    }
+    else
+    {
+      switch(std::get<1>(wt))
+      {
+        case eq:
+        case gt:
+        case lt:
+        case gte:
+        case lte:
+        case neq:
+        case nse:
+        case in:
+        case nin:
+        {
+          std::visit(overloaded
            {
-             for (auto &p : pv)
+             [&](parameter_t &p)
              {
                if (std::holds_alternative<bindValue_t>(p) || std::holds_alternative<std::string>(p))
                {
                  params.push_back(std::ref(p));
                }
-             }
-           },
-           [&](parameterSet_t &pv)
-           {
-             for (auto &p : pv)
+             },
+             [&](parameterVector_t &pv)
              {
-               if (std::holds_alternative<bindValue_t>(p) || std::holds_alternative<std::string>(p))
+               for (auto &p : pv)
                {
-                 //params.push_back(std::ref(pv));
-                 break;
+                 if (std::holds_alternative<bindValue_t>(p) || std::holds_alternative<std::string>(p))
+                 {
+                   params.push_back(std::ref(p));
+                 }
                }
-             }
-           },
-           [&](pointer_t &pt)
-           {
-             //returnValue = returnValue || pt->hasBindValues();
-           },
-         }, std::get<2>(wt));
-        break;
-      };
-      case between:
-      {
-        if (std::holds_alternative<parameterVector_t>(std::get<2>(wt)))
+             },
+             [&](parameterSet_t &pv)
+             {
+                 // Set elements are const. The references must not be used to change the values.
+
+               for (auto const &p : pv)
+               {
+                 if (std::holds_alternative<bindValue_t>(p) || std::holds_alternative<std::string>(p))
+                 {
+                   params.push_back(std::ref(const_cast<parameter_t &>(p)));
+                 }
+               }
+             },
+             [&](pointer_t &pt)
+             {
+               //returnValue = returnValue || pt->hasBindValues();
+             },
+           }, std::get<2>(wt));
+          break;
+        };
+        case between:
         {
-//          returnValue.insert(std::ref(std::get<parameterVector_t>(std::get<2>(wt))[0]));
-//          returnValue.insert(std::ref(std::get<parameterVector_t>(std::get<2>(wt))[1]));
+          if (std::holds_alternative<parameterVector_t>(std::get<2>(wt)))
+          {
+  //          returnValue.insert(std::ref(std::get<parameterVector_t>(std::get<2>(wt))[0]));
+  //          returnValue.insert(std::ref(std::get<parameterVector_t>(std::get<2>(wt))[1]));
+          }
+          break;
+        }
+        default:
+        {
+          CODE_ERROR();
+          break;
         }
-        break;
-      }
-      default:
-      {
-        CODE_ERROR();
-        break;
       }
-    }
+    };
   }
 
   /// @brief      Converts a where_logical to a parameter.
   /// @param[in]  w: The whereLogical to convert.
   /// @throws
+  /// @version    2026-10-16/GGB - Adds the parameters of both sides.
   /// @version    2022-06-07/GGB - Function created.
 
   void sqlWriter::to_parameter(whereLogical_t &wl, std::list<bindParameter_t> &params)
   {
-    CODE_ERROR();
-//    returnValue += to_string(*std::get<0>(wl));
-//    returnValue += " " + logicalOperatorMap[std::get<1>(wl)] + " ";
-//    returnValue += to_string(*std::get<2>(wl)) + ")";
-
-
+    for (whereVariant_t *side : { std::get<0>(wl).get(), std::get<2>(wl).get() })
+    {
+      std::visit(overloaded
+      {
+        [&](std::monostate &) { },
+        [&](whereTest_t &wt) { to_parameter(wt, params); },
+        [&](whereLogical_t &l) { to_parameter(l, params); },
+      }, side->base);
+    };
   }
 
   /// @brief      to_string function for a columnRef.
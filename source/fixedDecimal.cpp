@@ -0,0 +1,312 @@
+﻿//*********************************************************************************************************************************
+//
+// PROJECT:             General Class Library
+// FILE:                fixedDecimal.cpp
+// SUBSYSTEM:           Database library
+// LANGUAGE:            C++20
+// TARGET OS:           None - Standard C++
+// NAMESPACE:           GCL
+// AUTHOR:              Gavin Blakeman.
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the General Class Library (GCL)
+//
+//                      GCL is free software: you can redistribute it and/or modify it under the terms of the GNU General
+//                      Public License as published by the Free Software Foundation, either version 2 of the License, or
+//                      (at your option) any later version.
+//
+//                      GCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+//                      implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//                      for more details.
+//
+//                      You should have received a copy of the GNU General Public License along with GCL.  If not,
+//                      see <http://www.gnu.org/licenses/>.
+//
+// OVERVIEW:            A fixed point decimal number stored as a scaled integer. This is used for DECIMAL(p, s) database values
+//                      where p <= 38. It does not allocate.
+//
+// CLASSES INCLUDED:    fixedDecimal_t
+//
+// HISTORY:             2026-10-16 GGB - File Created.
+//
+//*********************************************************************************************************************************
+
+#include "include/fixedDecimal.h"
+
+  // Standard C++ library header files
+
+#include <algorithm>
+#include <limits>
+#include <system_error>
+
+  // Miscellaneous library header files
+
+#include "boost/locale.hpp"
+
+  // GCL library header files
+
+#include "include/error.h"
+
+namespace GCL
+{
+#if defined(__SIZEOF_INT128__)
+  using umantissa_t = unsigned __int128;
+#else
+  using umantissa_t = std::uint64_t;
+#endif
+
+  static constexpr fixedDecimal_t::mantissa_t MANTISSA_MAX = static_cast<fixedDecimal_t::mantissa_t>(~umantissa_t(0) >> 1);
+
+  /// @brief      Multiplies a mantissa by 10^n.
+  /// @param[in,out] m: The mantissa to scale.
+  /// @param[in]  n: The power of ten.
+  /// @returns    false if the result would overflow. (m is then undefined)
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
+
+  static bool scaleUp(fixedDecimal_t::mantissa_t &m, unsigned n) noexcept
+  {
+    bool returnValue = true;
+
+    while (returnValue && (n-- != 0))
+    {
+      if ((m > MANTISSA_MAX / 10) || (m < -(MANTISSA_MAX / 10)))
+      {
+        returnValue = false;
+      }
+      else
+      {
+        m *= 10;
+      };
+    };
+
+    return returnValue;
+  }
+
+  /// @brief      Constructs the decimal from text. (See from_chars())
+  /// @param[in]  text: The text to parse.
+  /// @throws     GCL::runtime_error
+  /// @version    2026-10-16/GGB - Function created.
+
+  fixedDecimal_t::fixedDecimal_t(std::string_view text)
+  {
+    if (!from_chars(text, *this))
+    {
+      RUNTIME_ERROR(boost::locale::translate("Invalid fixed decimal, or too many digits: ").str() + std::string(text));
+    };
+  }
+
+  /// @brief      Appends the text of the decimal to a string.
+  /// @param[out] buffer: The string to append to.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-16/GGB - Function created.
+
+  void fixedDecimal_t::appendTo(std::string &buffer) const
+  {
+    char text[MAX_DIGITS + 260];        // Largest possible mantissa and scale.
+    auto const [end, ec] = to_chars(text, text + sizeof(text));
+
+    buffer.append(text, end);
+  }
+
+  /// @brief      Parses a decimal number. The format is [+|-]digits[.digits]. Exponents are not accepted.
+  /// @param[in]  text: The text to parse.
+  /// @param[out] value: The parsed value. Not changed if the text cannot be parsed.
+  /// @returns    false if the text is not a decimal number or has more than MAX_DIGITS significant digits or decimal places.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
+
+  bool fixedDecimal_t::from_chars(std::string_view text, fixedDecimal_t &value) noexcept
+  {
+    bool returnValue = true;
+    bool negative = false;
+    bool point = false;
+    bool anyDigits = false;
+    std::size_t index = 0;
+    std::size_t digits = 0;
+    std::uint8_t scale = 0;
+    mantissa_t m = 0;
+
+    if (!text.empty() && ((text.front() == '-') || (text.front() == '+')))
+    {
+      negative = (text.front() == '-');
+      index++;
+    };
+
+    for (; returnValue && (index < text.size()); index++)
+    {
+      char const c = text[index];
+
+      if ((c == '.') && !point)
+      {
+        point = true;
+      }
+      else if ((c >= '0') && (c <= '9'))
+      {
+        anyDigits = true;
+        if (point)
+        {
+          scale++;
+        };
+        if ((digits != 0) || (c != '0'))
+        {
+          digits++;
+        };
+        if ((digits > MAX_DIGITS) || (scale > MAX_DIGITS))
+        {
+          returnValue = false;
+        }
+        else
+        {
+          m = m * 10 + (c - '0');
+        };
+      }
+      else
+      {
+        returnValue = false;
+      };
+    };
+
+    if (returnValue && anyDigits)
+    {
+      value = fixedDecimal_t(negative ? -m : m, scale);
+    }
+    else
+    {
+      returnValue = false;
+    };
+
+    return returnValue;
+  }
+
+  /// @brief      Compares two decimals by value. The scales do not need to match.
+  /// @param[in]  rhs: The value to compare to.
+  /// @returns    The ordering.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
+
+  std::strong_ordering fixedDecimal_t::operator<=>(fixedDecimal_t const &rhs) const noexcept
+  {
+    mantissa_t lhsMantissa = mantissa_;
+    mantissa_t rhsMantissa = rhs.mantissa_;
+
+      // Bring both values to the larger scale. If that overflows, the scaled value has the larger magnitude.
+
+    if ((scale_ < rhs.scale_) && !scaleUp(lhsMantissa, rhs.scale_ - scale_))
+    {
+      return (mantissa_ < 0) ? std::strong_ordering::less : std::strong_ordering::greater;
+    }
+    else if ((scale_ > rhs.scale_) && !scaleUp(rhsMantissa, scale_ - rhs.scale_))
+    {
+      return (rhs.mantissa_ < 0) ? std::strong_ordering::greater : std::strong_ordering::less;
+    };
+
+    if (lhsMantissa < rhsMantissa)
+    {
+      return std::strong_ordering::less;
+    }
+    else if (lhsMantissa == rhsMantissa)
+    {
+      return std::strong_ordering::equal;
+    }
+    else
+    {
+      return std::strong_ordering::greater;
+    };
+  }
+
+  /// @brief      Converts the decimal to a string.
+  /// @returns    The text of the decimal.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-16/GGB - Function created.
+
+  std::string fixedDecimal_t::str() const
+  {
+    std::string returnValue;
+
+    appendTo(returnValue);
+    return returnValue;
+  }
+
+  /// @brief      Writes the decimal as text. The output has exactly scale() decimal places. Does not allocate.
+  /// @param[in]  first: The start of the output range.
+  /// @param[in]  last: The end of the output range.
+  /// @returns    As std::to_chars(). ptr is one past the last character written.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
+
+  std::to_chars_result fixedDecimal_t::to_chars(char *first, char *last) const noexcept
+  {
+    char digits[MAX_DIGITS + 2];        // Least significant digit first.
+    std::size_t count = 0;
+    bool const negative = (mantissa_ < 0);
+    umantissa_t value = negative ? umantissa_t(0) - static_cast<umantissa_t>(mantissa_) : static_cast<umantissa_t>(mantissa_);
+
+      // Peel off 19 digits at a time so that the inner loop uses 64 bit arithmetic.
+
+    while (value > std::numeric_limits<std::uint64_t>::max())
+    {
+      constexpr std::uint64_t CHUNK = 10000000000000000000ull;
+      std::uint64_t chunk = static_cast<std::uint64_t>(value % CHUNK);
+
+      value /= CHUNK;
+      for (int index = 0; index < 19; index++)
+      {
+        digits[count++] = static_cast<char>('0' + chunk % 10);
+        chunk /= 10;
+      };
+    };
+
+    std::uint64_t low = static_cast<std::uint64_t>(value);
+    do
+    {
+      digits[count++] = static_cast<char>('0' + low % 10);
+      low /= 10;
+    }
+    while (low != 0);
+
+    std::size_t const integerDigits = (count > scale_) ? count - scale_ : 0;
+    std::size_t const needed = (negative ? 1 : 0) + ((integerDigits != 0) ? integerDigits : 1) + ((scale_ != 0) ? scale_ + 1 : 0);
+
+    if (static_cast<std::size_t>(last - first) < needed)
+    {
+      return { last, std::errc::value_too_large };
+    };
+
+    char *output = first;
+
+    if (negative)
+    {
+      *output++ = '-';
+    };
+
+    if (integerDigits == 0)
+    {
+      *output++ = '0';
+    }
+    else
+    {
+      for (std::size_t index = count; index > scale_; index--)
+      {
+        *output++ = digits[index - 1];
+      };
+    };
+
+    if (scale_ != 0)
+    {
+      *output++ = '.';
+      for (std::size_t index = scale_; index > count; index--)
+      {
+        *output++ = '0';
+      };
+      for (std::size_t index = std::min<std::size_t>(count, scale_); index > 0; index--)
+      {
+        *output++ = digits[index - 1];
+      };
+    };
+
+    return { output, std::errc() };
+  }
+
+} // namespace GCL
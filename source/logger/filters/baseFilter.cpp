@@ -27,7 +27,8 @@
 //
 // CLASSES INCLUDED:    CDebugRecord
 //
-// HISTORY:             2024-02-05 GGB - Functions split from loggerCore into separate files
+// HISTORY:             2026-10-16 GGB - Added processAppendRecordString(). processRecordString() uses it.
+//                      2024-02-05 GGB - Functions split from loggerCore into separate files
 //
 //*********************************************************************************************************************************
 
@@ -38,15 +39,36 @@
 
 namespace GCL::logger
 {
+  /// @brief      Appends the text of a record to a buffer. The basic filter writes all records.
+  /// @param[in]  record: The record to output.
+  /// @param[out] buffer: The buffer to append the text to.
+  /// @returns    true if the record is written. If false, nothing is appended.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-16/GGB - Function created.
+
+  bool CBaseFilter::processAppendRecordString(CBaseRecord const &record, std::string &buffer)
+  {
+    record.appendText(buffer);
+
+    return true;
+  }
+
   /// @brief      Basic filter string
   /// @param[in]  record: The record to output.
-  /// @returns    The record text.
+  /// @returns    The record text, or std::nullopt if the record is not written.
   /// @throws
+  /// @version    2026-10-16/GGB - Created by processAppendRecordString(), so derived filters only need to override that.
   /// @version    2024-02-06/GGB - Function created.
 
   std::optional<std::string> CBaseFilter::processRecordString(CBaseRecord const &record)
   {
-    std::optional<std::string> returnValue = record.text();
+    std::optional<std::string> returnValue;
+    std::string text;
+
+    if (processAppendRecordString(record, text))
+    {
+      returnValue = std::move(text);
+    };
 
     return returnValue;
   }
@@ -27,7 +27,8 @@
 //
 // CLASSES INCLUDED:    CDebugRecord
 //
-// HISTORY:             2024-02-05 GGB - Functions split from loggerCore into separate files
+// HISTORY:             2026-10-16 GGB - processRecordString() replaced by processAppendRecordString().
+//                      2024-02-05 GGB - Functions split from loggerCore into separate files
 //
 //*********************************************************************************************************************************
 
@@ -35,6 +36,7 @@
 
   // Standard C++ libraries
 #include <iostream>
+#include <iterator>
 
 // Miscellaneous libraries
 #include <fmt/format.h>
@@ -98,15 +100,18 @@ namespace GCL::logger
     criticalityMask.merge(std::move(toAdd));
   }
 
-  /// @brief      Create the record string.
+  /// @brief      Appends the record string to a buffer.
   /// @param[in]  record: The record to process.
-  /// @returns    The text to output.
+  /// @param[out] buffer: The buffer to append the text to.
+  /// @returns    true if the record is written. If false, nothing is appended.
   /// @throws
+  /// @version    2026-10-16/GGB - Appends to the buffer supplied by the sink. (Was processRecordString())
   /// @version    2024-02-06/GGB - Function created.
 
-  std::optional<std::string> CDebugFilter::processRecordString(CBaseRecord const &record)
+  bool CDebugFilter::processAppendRecordString(CBaseRecord const &record, std::string &buffer)
   {
-    std::optional<std::string> returnValue;
+    bool returnValue = false;
+    std::size_t const start = buffer.size();
 
     try
     {
@@ -114,19 +119,20 @@ namespace GCL::logger
 
       if (criticalityMask.contains(debugRecord.severity()))
       {
-        std::string rv = fmt::format("{:%Y-%m-%d %H:%M:%S} [{:s}] {:s}",
-                                     debugRecord.timeStamp().dateTime(),
-                                     criticalityMap.at(debugRecord.severity()),
-                                     record.text());
-        returnValue = rv;
+        fmt::format_to(std::back_inserter(buffer), "{:%Y-%m-%d %H:%M:%S} [{:s}] ",
+                       debugRecord.timeStamp().dateTime(),
+                       criticalityMap.at(debugRecord.severity()));
+        record.appendText(buffer);
+        returnValue = true;
       }
     }
     catch(std::bad_cast &w)
     {
-      std::cerr << "Bad Cast in CDebugFilter::processRecordString: " << w.what() << std::endl;
+      std::cerr << "Bad Cast in CDebugFilter::processAppendRecordString: " << w.what() << std::endl;
     }
     catch(...)
     {
+      buffer.resize(start);
       std::cerr << "General Exception: " << std::endl;
     }
 
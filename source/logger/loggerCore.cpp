@@ -28,7 +28,9 @@
 //
 // CLASSES INCLUDED:    CLogger
 //
-// HISTORY:             2018-08-12 GGB - gnuCash-pud debugging and release.
+// HISTORY:             2026-10-16 GGB - The writer returns pooled records in bulk.
+//                      2026-10-16 GGB - The writer drains the queue in batches and flushes the sinks by their flush policy.
+//                      2018-08-12 GGB - gnuCash-pud debugging and release.
 //                      2015-09-22 GGB - AIRDAS 2015.09 release
 //                      2014-07-20 GGB - Development of class for "Observatory Weather System - Service"
 //
@@ -48,6 +50,7 @@
 // GCL include headers
 
 #include "include/error.h"
+#include "include/logger/records/recordPool.h"
 
 namespace GCL::logger
 {
@@ -118,9 +121,34 @@ namespace GCL::logger
     return returnValue;
   }
 
+  /// @brief      Writes the queued records to the sinks, a batch at a time. Each sink receives a batch in one call. The records
+  ///             of each batch are returned to their pools together.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
+
+  void CLogger::drainQueue()
+  {
+    batch.clear();
+    while (messageQueue->take(batch, batchSize_) != 0)
+    {
+      {
+        uniqueLock ul{sinkMutex};
+        for (auto &sink : logSinks)
+        {
+          sink.second->writeRecords(batch);
+        };
+      }
+      batch.clear();
+      CRecordPool::flushReturns();
+    };
+  }
+
   /// @brief      Creates a log message in place on the queue.
   /// @param[in]  record: The message to log.
   /// @throws     std::bad_alloc
+  /// @details    Only the first message after the writer wakes releases the semaphore. Releasing a binary semaphore that is
+  ///             already released is undefined.
+  /// @version    2026-10-16/GGB - Only release the semaphore if the writer has not been woken.
   /// @version    2024-02-07/GGB - Updated to use atomic_flag and semaphores.
   /// @version    2014-12-25/GGB - Changed to create the logger record immediately on entry. The log record is also a smart pointer.
   /// @version    2014-07-20/GGB - Function created.
@@ -128,7 +156,10 @@ namespace GCL::logger
   void CLogger::logMessage(std::unique_ptr<CBaseRecord> &&record)
   {
     messageQueue->push(std::move(record));
-    messageWaiting.release();
+    if (!wakePending.exchange(true, std::memory_order_acq_rel))
+    {
+      messageWaiting.release();
+    };
   }
 
   /// @brief      Returns a pointer to the specified sink.
@@ -171,6 +202,7 @@ namespace GCL::logger
 
   /// @brief      Shuts down the writer thread.
   /// @throws     None.
+  /// @version    2026-10-16/GGB - Drains the queue in batches and flushes all the sinks.
   /// @version    2024-02-07/GGB - Updated to use atomic_flag and semaphores.
   /// @version    2019-10-22/GGB - 1. Changed writerThread to a std::unique_ptr
   ///                              2. Changed writerThread from a boost::thread to a std::thread
@@ -182,22 +214,20 @@ namespace GCL::logger
     if (writerThread)
     {
       terminateThread.test_and_set();
-      messageWaiting.release();         // Ensure the thread unblocks
+      if (!wakePending.exchange(true, std::memory_order_acq_rel))
+      {
+        messageWaiting.release();         // Ensure the thread unblocks
+      };
 
       writerThread->join();
       writerThread.reset(nullptr);
 
-      while (!messageQueue->empty())
-      {
-        CBaseRecord const &record = messageQueue->front();
-
-        uniqueLock ul{sinkMutex};
-        for (auto &sink : logSinks)
-        {
-          sink.second->writeRecord(record);
-        }
+      drainQueue();
 
-        messageQueue->pop();
+      uniqueLock ul{sinkMutex};
+      for (auto &sink : logSinks)
+      {
+        sink.second->flush();
       };
     }
   }
@@ -205,7 +235,9 @@ namespace GCL::logger
   /// @brief      This is the threaded function that executes concurrently.
   /// @details    Whenever a message is added to the queue, this is the function that writes it to the stream.
   /// @note       The writer thread may be called and active before sinks and queues are available.
+  /// @note       When a sink has unflushed records, the wait ends when the sink's flush is due.
   /// @throws     None.
+  /// @version    2026-10-16/GGB - Writes batches of records and flushes the sinks by their flush policy.
   /// @version    2024-02-07/GGB - Updated to use atomic_flag and semaphores.
   /// @version    2016-05-07/GGB - Updated locking strategy to remove a number of errors.
   /// @version    2015-09-19/GGB - Added locking to the sink container.
@@ -216,19 +248,47 @@ namespace GCL::logger
   {
     while (!terminateThread.test())
     {
-      messageWaiting.acquire();
+      std::optional<CBaseSink::clock_type::time_point> flushDue;
 
-      while (!messageQueue->empty())
       {
-        CBaseRecord const &record = messageQueue->front();
+        uniqueLock ul{sinkMutex};
+        for (auto &sink : logSinks)
         {
-          uniqueLock ul{sinkMutex};
-          for (auto &sink : logSinks)
+          std::optional<CBaseSink::clock_type::time_point> due = sink.second->flushDue();
+
+          if (due && (!flushDue || (*due < *flushDue)))
           {
-            sink.second->writeRecord(record);
-          }
-        }
-        messageQueue->pop();
+            flushDue = due;
+          };
+        };
+      }
+
+      bool acquired = true;
+
+      if (flushDue)
+      {
+        acquired = messageWaiting.try_acquire_until(*flushDue);
+      }
+      else
+      {
+        messageWaiting.acquire();
+      };
+
+        // A producer that set wakePending after the wait timed out releases the semaphore. It must be acquired before
+        // wakePending is cleared, or the next producer would release it a second time.
+
+      if (wakePending.exchange(false, std::memory_order_acq_rel) && !acquired)
+      {
+        messageWaiting.acquire();
+      };
+
+      drainQueue();
+
+      uniqueLock ul{sinkMutex};
+      CBaseSink::clock_type::time_point now = CBaseSink::clock_type::now();
+      for (auto &sink : logSinks)
+      {
+        sink.second->flushIfDue(now);
       };
     };
   }
@@ -27,7 +27,8 @@
 //
 // CLASSES INCLUDED:
 //
-// HISTORY:             2024-02-05 GGB - Functions split from loggerCore into separate files
+// HISTORY:             2026-10-16 GGB - The default logger uses CLockFreeQueue.
+//                      2024-02-05 GGB - Functions split from loggerCore into separate files
 //
 //*********************************************************************************************************************************
 
@@ -41,7 +42,7 @@
 
 #include "include/error.h"
 
-#include "include/logger/queues/queueQueue.h"
+#include "include/logger/queues/lockFreeQueue.h"
 #include "include/logger/sinks/streamSink.h"
 #include "include/logger/filters/debugFilter.h"
 
@@ -63,6 +64,7 @@ namespace GCL::logger
 
   /// @brief      Creates the default logger.
   /// @throws
+  /// @version    2026-10-16/GGB - Uses the lock free queue.
   /// @version    2024-02-06/GGB - Function created.
 
   void CLoggerManager::createDefaultLogger()
@@ -84,7 +86,7 @@ namespace GCL::logger
     std::shared_ptr<CDebugFilter> filter = std::make_shared<CDebugFilter>(criticalityMap, criticalityMask);
     std::unique_ptr<CBaseSink> sink = std::make_unique<CStreamSink>(filter, std::cout);
 
-    logger->addQueue(std::make_unique<CQueueQueue>());
+    logger->addQueue(std::make_unique<CLockFreeQueue>());
     logger->addSink("cout", std::move(sink));
     logger->startup();
     addLogger("DEFAULT", std::move(logger));
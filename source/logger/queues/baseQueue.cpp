@@ -27,7 +27,9 @@
 //
 // CLASSES INCLUDED:    CBaseQueue
 //
-// HISTORY:             2024-02-05 GGB - Functions split from loggerCore into seperate files
+// HISTORY:             2026-10-16 GGB - Added take().
+//                      2026-10-16 GGB - The queue mutex is only taken for synchronised queues.
+//                      2024-02-05 GGB - Functions split from loggerCore into seperate files
 //
 //*********************************************************************************************************************************
 
@@ -40,38 +42,92 @@ namespace GCL::logger
   /// @brief      Returns the next record for processing.
   /// @returns    Constant reference to the next record for processing.
   /// @throws
+  /// @version    2026-10-16/GGB - The lock is only taken for synchronised queues.
   /// @version    2024-02-06/GGB - Function created.
 
   CBaseRecord const &CBaseQueue::front() const
   {
-    readLock sl(queueMutex);
+    readLock sl(queueMutex, std::defer_lock);
+
+    if (synchronised_)
+    {
+      sl.lock();
+    };
     return processFront();
   }
 
   /// @brief      Pushes a record into the queue.
   /// @param[in]  r: The record to push. (The record is moved)
   /// @throws
+  /// @version    2026-10-16/GGB - The lock is only taken for synchronised queues.
   /// @version    2024-02-06/GGB - Function created.
 
   void CBaseQueue::push(std::unique_ptr<CBaseRecord> &&r)
   {
-    writeLock ul(queueMutex);
+    writeLock ul(queueMutex, std::defer_lock);
+
+    if (synchronised_)
+    {
+      ul.lock();
+    };
     processPush(std::move(r));
   }
 
   /// @brief      Pops a record from the queue.
   /// @throws
+  /// @version    2026-10-16/GGB - The lock is only taken for synchronised queues.
   /// @version    2024-02-06/GGB - Function created.
 
   void CBaseQueue::pop()
   {
-    writeLock ul(queueMutex);
+    writeLock ul(queueMutex, std::defer_lock);
+
+    if (synchronised_)
+    {
+      ul.lock();
+    };
     processPop();
   }
 
+  /// @brief      Moves records from the front of the queue to the end of a batch. The queue mutex is taken once.
+  /// @param[out] batch: The batch to append the records to.
+  /// @param[in]  maxRecords: The maximum number of records to take.
+  /// @returns    The number of records taken.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-16/GGB - Function created.
+
+  std::size_t CBaseQueue::take(recordBatch_t &batch, std::size_t maxRecords)
+  {
+    std::size_t returnValue = 0;
+    writeLock ul(queueMutex, std::defer_lock);
+
+    if (synchronised_)
+    {
+      ul.lock();
+    };
+
+    while ((returnValue < maxRecords) && !processEmpty())
+    {
+      batch.push_back(processTake());
+      returnValue++;
+    };
+
+    return returnValue;
+  }
+
+  /// @brief      Determines if the queue is empty.
+  /// @returns    true if the queue is empty.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - The lock is only taken for synchronised queues.
+
   bool CBaseQueue::empty() const noexcept
   {
-    writeLock ul(queueMutex);
+    writeLock ul(queueMutex, std::defer_lock);
+
+    if (synchronised_)
+    {
+      ul.lock();
+    };
     return processEmpty();
   }
 
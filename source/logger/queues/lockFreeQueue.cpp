@@ -0,0 +1,203 @@
+﻿//*********************************************************************************************************************************
+//
+// PROJECT:             General Class Library
+// FILE:                lockFreeQueue.cpp
+// SUBSYSTEM:           Logging Functions
+// LANGUAGE:            C++20
+// TARGET OS:           None - Standard C++
+// NAMESPACE:           GCL
+// AUTHOR:              Gavin Blakeman.
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the General Class Library (GCL)
+//
+//                      GCL is free software: you can redistribute it and/or modify it under the terms of the GNU General
+//                      Public License as published by the Free Software Foundation, either version 2 of the License, or
+//                      (at your option) any later version.
+//
+//                      GCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+//                      implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//                      for more details.
+//
+//                      You should have received a copy of the GNU General Public License along with GCL.  If not,
+//                      see <http://www.gnu.org/licenses/>.
+//
+// OVERVIEW:            Lock free multiple producer, single consumer record queue.
+//
+// CLASSES INCLUDED:    CLockFreeQueue
+//
+// HISTORY:             2026-10-16 GGB - The queue is intrusive. Records are linked through CBaseRecord.
+//                      2026-10-16 GGB - Added processTake().
+//                      2026-10-16 GGB - File Created.
+//
+//*********************************************************************************************************************************
+
+#include "include/logger/queues/lockFreeQueue.h"
+
+  // GCL header files
+
+#include "include/error.h"
+
+namespace GCL::logger
+{
+  /// @brief      Constructs an empty queue.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - The queue starts with the stub record.
+  /// @version    2026-10-16/GGB - Function created.
+
+  CLockFreeQueue::CLockFreeQueue() : CBaseQueue(false), head_(&stub_), tail_(&stub_)
+  {
+  }
+
+  /// @brief      Destroys the queue and any records that have not been taken.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
+
+  CLockFreeQueue::~CLockFreeQueue()
+  {
+    while (tail_ != nullptr)
+    {
+      CBaseRecord *next = tail_->next_.load(std::memory_order_acquire);
+
+      if (tail_ != &stub_)
+      {
+        delete tail_;
+      };
+      tail_ = next;
+    };
+  }
+
+  /// @brief      Links a record at the head of the queue. Called by any thread.
+  /// @param[in]  r: The record to link.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
+
+  void CLockFreeQueue::link(CBaseRecord *r) const noexcept
+  {
+    r->next_.store(nullptr, std::memory_order_relaxed);
+
+    CBaseRecord *previous = head_.exchange(r, std::memory_order_acq_rel);
+    previous->next_.store(r, std::memory_order_release);
+  }
+
+  /// @brief      Returns the front record if it can be removed. Moves the tail past the stub. If the front record is the
+  ///             head, the stub is linked behind it so that it has a successor. Called by the writer thread only.
+  /// @returns    The front record. nullptr if the queue is empty, or the next record is still being linked.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
+
+  CBaseRecord *CLockFreeQueue::frontRecord() const noexcept
+  {
+    CBaseRecord *returnValue = nullptr;
+    CBaseRecord *next = tail_->next_.load(std::memory_order_acquire);
+
+    if (tail_ == &stub_)
+    {
+      if (next != nullptr)
+      {
+        tail_ = next;
+        next = tail_->next_.load(std::memory_order_acquire);
+      };
+    };
+
+    if (tail_ != &stub_)
+    {
+      if (next != nullptr)
+      {
+        returnValue = tail_;
+      }
+      else if (tail_ == head_.load(std::memory_order_acquire))
+      {
+        link(&stub_);
+        if (tail_->next_.load(std::memory_order_acquire) != nullptr)
+        {
+          returnValue = tail_;
+        };
+      };
+    };
+
+    return returnValue;
+  }
+
+  /// @brief      Links a new record at the head of the queue. Called by any thread.
+  /// @param[in]  r: The record to be moved to the queue.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - The record is linked directly. (No node is allocated)
+  /// @version    2026-10-16/GGB - Function created.
+
+  void CLockFreeQueue::processPush(std::unique_ptr<CBaseRecord> &&r)
+  {
+    link(r.release());
+  }
+
+  /// @brief      Removes the front record. Called by the writer thread only.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
+
+  void CLockFreeQueue::processPop()
+  {
+    CBaseRecord *front = frontRecord();
+
+    if (front != nullptr)
+    {
+      tail_ = front->next_.load(std::memory_order_acquire);
+      delete front;
+    };
+  }
+
+  /// @brief      Removes the front record and returns it. Called by the writer thread only.
+  /// @returns    The first record in the queue.
+  /// @throws     GCL::CCodeError (Empty queue)
+  /// @version    2026-10-16/GGB - Function created.
+
+  std::unique_ptr<CBaseRecord> CLockFreeQueue::processTake()
+  {
+    std::unique_ptr<CBaseRecord> returnValue;
+    CBaseRecord *front = frontRecord();
+
+    if (front != nullptr)
+    {
+      tail_ = front->next_.load(std::memory_order_acquire);
+      returnValue.reset(front);
+    }
+    else
+    {
+      CODE_ERROR();
+      // Does not return.
+    };
+
+    return returnValue;
+  }
+
+  /// @brief      Determines if the queue is empty. Called by the writer thread only.
+  /// @returns    true if the queue is empty.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
+
+  bool CLockFreeQueue::processEmpty() const noexcept
+  {
+    return (frontRecord() == nullptr);
+  }
+
+  /// @brief      Returns the front record. Called by the writer thread only.
+  /// @returns    The first record in the queue.
+  /// @throws     GCL::CCodeError (Empty queue)
+  /// @version    2026-10-16/GGB - Function created.
+
+  CBaseRecord const &CLockFreeQueue::processFront() const
+  {
+    CBaseRecord *front = frontRecord();
+
+    if (front != nullptr)
+    {
+      return *front;
+    }
+    else
+    {
+      CODE_ERROR();
+      // Does not return.
+    }
+  }
+
+} // namespace
@@ -27,7 +27,8 @@
 //
 // CLASSES INCLUDED:    CQueueQueue
 //
-// HISTORY:             2024-02-05 GGB - Functions split from loggerCore into seperate files
+// HISTORY:             2026-10-16 GGB - Added processTake().
+//                      2024-02-05 GGB - Functions split from loggerCore into seperate files
 //
 //*********************************************************************************************************************************
 
@@ -62,6 +63,29 @@ namespace GCL::logger
     };
   }
 
+  /// @brief      Removes the first item from the queue and returns it.
+  /// @returns    The first item in the queue.
+  /// @throws     GCL::CCodeError (Empty queue)
+  /// @version    2026-10-16/GGB - Function created.
+
+  std::unique_ptr<CBaseRecord> CQueueQueue::processTake()
+  {
+    std::unique_ptr<CBaseRecord> returnValue;
+
+    if (!queue.empty())
+    {
+      returnValue = std::move(queue.front());
+      queue.pop();
+    }
+    else
+    {
+      CODE_ERROR();
+      // Does not return.
+    };
+
+    return returnValue;
+  }
+
   /// @brief      Determines if the queue is empty.
   /// @returns    true if the queue is empty.
   /// @throws
@@ -0,0 +1,273 @@
+﻿//*********************************************************************************************************************************
+//
+// PROJECT:             General Class Library
+// FILE:                ringQueue.cpp
+// SUBSYSTEM:           Logging Functions
+// LANGUAGE:            C++20
+// TARGET OS:           None - Standard C++
+// NAMESPACE:           GCL
+// AUTHOR:              Gavin Blakeman.
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the General Class Library (GCL)
+//
+//                      GCL is free software: you can redistribute it and/or modify it under the terms of the GNU General
+//                      Public License as published by the Free Software Foundation, either version 2 of the License, or
+//                      (at your option) any later version.
+//
+//                      GCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+//                      implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//                      for more details.
+//
+//                      You should have received a copy of the GNU General Public License along with GCL.  If not,
+//                      see <http://www.gnu.org/licenses/>.
+//
+// OVERVIEW:            Bounded record queue with overflow policies.
+//
+// CLASSES INCLUDED:    CRingQueue
+//
+// HISTORY:             2026-10-16 GGB - Added processTake().
+//                      2026-10-16 GGB - File Created.
+//
+//*********************************************************************************************************************************
+
+#include "include/logger/queues/ringQueue.h"
+
+  // Miscellaneous library header files
+
+#include "boost/locale.hpp"
+
+  // GCL header files
+
+#include "include/error.h"
+
+namespace GCL::logger
+{
+  /// @brief      Constructs an empty queue.
+  /// @param[in]  capacity: The maximum number of records in the queue.
+  /// @param[in]  policy: How a push to a full queue is handled.
+  /// @throws     std::bad_alloc
+  /// @throws     GCL::CRuntimeAssert
+  /// @version    2026-10-16/GGB - Function created.
+
+  CRingQueue::CRingQueue(std::size_t capacity, EOverflowPolicy policy) : slots(capacity), policy_(policy)
+  {
+    RUNTIME_ASSERT(capacity != 0, boost::locale::translate("LOGGER: Queue capacity must not be zero."));
+  }
+
+  /// @brief      Constructs an empty queue that discards records by severity when it is full.
+  /// @param[in]  capacity: The maximum number of records in the queue.
+  /// @param[in]  keep: The severities that are never discarded.
+  /// @throws     std::bad_alloc
+  /// @throws     GCL::CRuntimeAssert
+  /// @version    2026-10-16/GGB - Function created.
+
+  CRingQueue::CRingQueue(std::size_t capacity, severityMask_t &&keep)
+    : slots(capacity), policy_(dropSeverity), keptSeverities(std::move(keep))
+  {
+    RUNTIME_ASSERT(capacity != 0, boost::locale::translate("LOGGER: Queue capacity must not be zero."));
+  }
+
+  /// @brief      Determines if a record is never discarded by the dropSeverity policy.
+  /// @param[in]  record: The record to test.
+  /// @returns    true if the record is kept.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
+
+  bool CRingQueue::kept(CBaseRecord const &record) const
+  {
+    CDebugRecord const *debugRecord = dynamic_cast<CDebugRecord const *>(&record);
+
+    return (debugRecord == nullptr) || keptSeverities.contains(debugRecord->severity());
+  }
+
+  /// @brief      Discards a record. The records in front of it move back one slot. (The record objects do not move)
+  /// @param[in]  n: The position of the record from the front of the queue.
+  /// @returns    true if a record was discarded.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
+
+  bool CRingQueue::discard(std::size_t n)
+  {
+    bool returnValue = false;
+
+    if (n < count)
+    {
+      slots[slot(n)].reset();
+      for (std::size_t index = n; index > 0; index--)
+      {
+        slots[slot(index)] = std::move(slots[slot(index - 1)]);
+      };
+      head = slot(1);
+      count--;
+      dropped_.fetch_add(1, std::memory_order_relaxed);
+      returnValue = true;
+    };
+
+    return returnValue;
+  }
+
+  /// @brief      Discards the oldest record that is not kept. The front record is skipped if the writer holds it.
+  /// @returns    true if a record was discarded.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
+
+  bool CRingQueue::discardNotKept()
+  {
+    bool returnValue = false;
+
+    for (std::size_t index = frontTaken ? 1 : 0; !returnValue && (index < count); index++)
+    {
+      if (!kept(*slots[slot(index)]))
+      {
+        returnValue = discard(index);
+      };
+    };
+
+    return returnValue;
+  }
+
+  /// @brief      Stores a record, applying the overflow policy if the queue is full. Called with the queue mutex held.
+  /// @param[in]  r: The record to be moved to the queue.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
+
+  void CRingQueue::processPush(std::unique_ptr<CBaseRecord> &&r)
+  {
+    bool store = true;
+    bool wait = false;
+
+    if (count == slots.size())
+    {
+      switch (policy_)
+      {
+        case block:
+        {
+          wait = true;
+          break;
+        }
+        case dropNewest:
+        {
+          store = false;
+          break;
+        }
+        case dropOldest:
+        {
+          store = discard(frontTaken ? 1 : 0);
+          break;
+        }
+        case dropSeverity:
+        {
+          if (!kept(*r))
+          {
+            store = false;
+          }
+          else
+          {
+            wait = !discardNotKept();
+          };
+          break;
+        }
+        default:
+        {
+          CODE_ERROR();
+          // Does not return.
+        }
+      };
+    };
+
+    if (wait)
+    {
+        // The queue mutex is held by CBaseQueue::push(). It is released while waiting and is still held on return.
+
+      std::unique_lock<mutex_type> lock(queueMutex, std::adopt_lock);
+
+      blocked_.fetch_add(1, std::memory_order_relaxed);
+      cvQueueData.wait(lock, [this]() { return count < slots.size(); });
+      lock.release();
+    };
+
+    if (store)
+    {
+      slots[slot(count)] = std::move(r);
+      count++;
+    }
+    else
+    {
+      dropped_.fetch_add(1, std::memory_order_relaxed);
+    };
+  }
+
+  /// @brief      Removes the front record and wakes a waiting producer.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
+
+  void CRingQueue::processPop()
+  {
+    if (count != 0)
+    {
+      slots[head].reset();
+      head = slot(1);
+      count--;
+      frontTaken = false;
+      cvQueueData.notify_one();
+    };
+  }
+
+  /// @brief      Removes the front record, returns it and wakes a waiting producer.
+  /// @returns    The first record in the queue.
+  /// @throws     GCL::CCodeError (Empty queue)
+  /// @version    2026-10-16/GGB - Function created.
+
+  std::unique_ptr<CBaseRecord> CRingQueue::processTake()
+  {
+    std::unique_ptr<CBaseRecord> returnValue;
+
+    if (count != 0)
+    {
+      returnValue = std::move(slots[head]);
+      head = slot(1);
+      count--;
+      frontTaken = false;
+      cvQueueData.notify_one();
+    }
+    else
+    {
+      CODE_ERROR();
+      // Does not return.
+    };
+
+    return returnValue;
+  }
+
+  /// @brief      Determines if the queue is empty.
+  /// @returns    true if the queue is empty.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
+
+  bool CRingQueue::processEmpty() const noexcept
+  {
+    return (count == 0);
+  }
+
+  /// @brief      Returns the front record. The record is not discarded by the overflow policy until it is popped.
+  /// @returns    The first record in the queue.
+  /// @throws     GCL::CCodeError (Empty queue)
+  /// @version    2026-10-16/GGB - Function created.
+
+  CBaseRecord const &CRingQueue::processFront() const
+  {
+    if (count != 0)
+    {
+      frontTaken = true;
+      return *slots[head];
+    }
+    else
+    {
+      CODE_ERROR();
+      // Does not return.
+    }
+  }
+
+} // namespace
@@ -27,7 +27,10 @@
 //
 // CLASSES INCLUDED:    CDebugRecord
 //
-// HISTORY:             2024-02-05 GGB - Functions split from loggerCore into separate files
+// HISTORY:             2026-10-16 GGB - Added processAppendText().
+//                      2026-10-16 GGB - Short messages are stored in the record.
+//                      2026-10-16 GGB - Added constructor for records that create their text.
+//                      2024-02-05 GGB - Functions split from loggerCore into separate files
 //
 //*********************************************************************************************************************************
 
@@ -39,11 +42,66 @@ namespace GCL::logger
   /// @brief      Constructor for the class.
   /// @param[in]  s: The severity of the message.
   /// @param[in]  t: The message to be logged.
-  /// @throws     None.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-16/GGB - Short messages are stored in the record.
   /// @version    2014-07-20/GGB - Function created.
 
-  CDebugRecord::CDebugRecord(severity_t s, std::string const &t) : CBaseRecord(t), severity_(s), timeStamp_(std::chrono::system_clock::now())
+  CDebugRecord::CDebugRecord(severity_t s, std::string_view t)
+    : CBaseRecord((t.size() > INLINE_TEXT_SIZE) ? std::string(t) : std::string()), severity_(s),
+      timeStamp_(std::chrono::system_clock::now())
+  {
+    if (t.size() <= INLINE_TEXT_SIZE)
+    {
+      t.copy(inlineText_, t.size());
+      inlineSize_ = static_cast<std::uint8_t>(t.size());
+    };
+  }
+
+  /// @brief      Constructor for derived records that create the text when it is written.
+  /// @param[in]  s: The severity of the message.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
+
+  CDebugRecord::CDebugRecord(severity_t s) : CBaseRecord(), severity_(s), timeStamp_(std::chrono::system_clock::now())
+  {
+  }
+
+  /// @brief      Returns the text of the record.
+  /// @returns    The text of the record.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-16/GGB - Function created.
+
+  std::string CDebugRecord::processText() const
+  {
+    std::string returnValue;
+
+    if (inlineSize_ != 0)
+    {
+      returnValue.assign(inlineText_, inlineSize_);
+    }
+    else
+    {
+      returnValue = CBaseRecord::processText();
+    };
+
+    return returnValue;
+  }
+
+  /// @brief      Appends the text of the record to a buffer.
+  /// @param[out] buffer: The buffer to append the text to.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-16/GGB - Function created.
+
+  void CDebugRecord::processAppendText(std::string &buffer) const
   {
+    if (inlineSize_ != 0)
+    {
+      buffer.append(inlineText_, inlineSize_);
+    }
+    else
+    {
+      buffer += storedText();
+    };
   }
 
 } // namespace
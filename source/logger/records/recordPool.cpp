@@ -0,0 +1,305 @@
+﻿//*********************************************************************************************************************************
+//
+// PROJECT:             General Class Library
+// FILE:                recordPool.cpp
+// SUBSYSTEM:           Logging Functions
+// LANGUAGE:            C++20
+// TARGET OS:           None - Standard C++
+// NAMESPACE:           GCL
+// AUTHOR:              Gavin Blakeman.
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the General Class Library (GCL)
+//
+//                      GCL is free software: you can redistribute it and/or modify it under the terms of the GNU General
+//                      Public License as published by the Free Software Foundation, either version 2 of the License, or
+//                      (at your option) any later version.
+//
+//                      GCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+//                      implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//                      for more details.
+//
+//                      You should have received a copy of the GNU General Public License along with GCL.  If not,
+//                      see <http://www.gnu.org/licenses/>.
+//
+// OVERVIEW:            Per thread memory pools for log records.
+//
+// CLASSES INCLUDED:    CRecordPool
+//
+// HISTORY:             2026-10-16 GGB - Added slabs().
+//                      2026-10-16 GGB - File Created.
+//
+//*********************************************************************************************************************************
+
+#include "include/logger/records/recordPool.h"
+
+  // Standard C++ library header files
+
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace GCL::logger
+{
+  /// @brief    State of the pools for a thread. This is trivially destructible so that records can still be destroyed
+  ///           after the thread's other thread_local objects. (eg by a logger destroyed during static destruction)
+
+  struct threadState_t
+  {
+    CRecordPool *pool;                        ///< The pool of the thread. Created on the first allocation.
+    CRecordPool *returnOwner;                 ///< Pool that the held blocks are returned to.
+    CRecordPool::block_t *returnFirst;        ///< Held blocks. (Chain)
+    CRecordPool::block_t *returnLast;
+    std::size_t returnCount;
+    bool ended;                               ///< The thread is ending. Blocks are no longer held or taken from the pool.
+
+    static void end() noexcept;
+  };
+
+  namespace
+  {
+    /// @brief  Ends the thread state when the thread ends. Constructed by the first use of the pools by the thread.
+
+    struct threadExit_t
+    {
+      bool started = false;
+
+      ~threadExit_t() { threadState_t::end(); }
+    };
+
+    thread_local threadState_t threadState{};
+    thread_local threadExit_t threadExit;
+
+    std::atomic<std::size_t> slabCount = 0;   ///< Slabs allocated by all the pools.
+
+      // The pools of ended threads. These are never destroyed as records may be destroyed during static destruction.
+
+    std::mutex &abandonedMutex()
+    {
+      static std::mutex *mutex = new std::mutex;
+      return *mutex;
+    }
+
+    std::vector<CRecordPool *> &abandonedPools()
+    {
+      static std::vector<CRecordPool *> *pools = new std::vector<CRecordPool *>;
+      return *pools;
+    }
+  }
+
+  /// @brief      Returns the held blocks and gives the pool of the thread to the next thread that creates records.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
+
+  void threadState_t::end() noexcept
+  {
+    CRecordPool::flushReturns();
+
+    if (threadState.pool != nullptr)
+    {
+      std::lock_guard<std::mutex> lock(abandonedMutex());
+
+      abandonedPools().push_back(threadState.pool);
+      threadState.pool = nullptr;
+    };
+
+    threadState.ended = true;
+  }
+
+  /// @brief      Allocates storage for a record.
+  /// @param[in]  size: The size of the record.
+  /// @returns    Pointer to the storage.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-16/GGB - Function created.
+
+  void *CRecordPool::allocate(std::size_t size)
+  {
+    void *returnValue;
+
+    if (size > PAYLOAD_SIZE)
+    {
+      returnValue = ::operator new(size);
+    }
+    else
+    {
+      block_t *block;
+
+      if (threadState.ended)
+      {
+        block = static_cast<block_t *>(::operator new(BLOCK_SIZE));
+        block->owner = nullptr;
+      }
+      else
+      {
+        block = threadPool().take();
+      };
+
+      returnValue = payloadOf(block);
+    };
+
+    return returnValue;
+  }
+
+  /// @brief      Releases the storage of a record. Blocks from the pool of the thread are put straight on its free list.
+  ///             Blocks from other pools are held and returned in a chain.
+  /// @param[in]  p: The storage to release.
+  /// @param[in]  size: The size of the record.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
+
+  void CRecordPool::deallocate(void *p, std::size_t size) noexcept
+  {
+    if (size > PAYLOAD_SIZE)
+    {
+      ::operator delete(p);
+    }
+    else
+    {
+      block_t *block = blockOf(p);
+      CRecordPool *owner = block->owner;
+
+      if (owner == nullptr)
+      {
+        ::operator delete(block);
+      }
+      else if (threadState.ended)
+      {
+        owner->pushRemote(block, block);
+      }
+      else if (owner == threadState.pool)
+      {
+        block->next = owner->freeList;
+        owner->freeList = block;
+      }
+      else
+      {
+        threadExit.started = true;
+
+        if ((threadState.returnOwner != owner) || (threadState.returnCount == RETURN_BATCH))
+        {
+          flushReturns();
+        };
+
+        block->next = threadState.returnFirst;
+        threadState.returnFirst = block;
+        if (threadState.returnLast == nullptr)
+        {
+          threadState.returnLast = block;
+        };
+        threadState.returnOwner = owner;
+        threadState.returnCount++;
+      };
+    };
+  }
+
+  /// @brief      Returns the blocks held by the calling thread to their pool. Called by the logger after each batch.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
+
+  void CRecordPool::flushReturns() noexcept
+  {
+    if (threadState.returnCount != 0)
+    {
+      threadState.returnOwner->pushRemote(threadState.returnFirst, threadState.returnLast);
+      threadState.returnFirst = nullptr;
+      threadState.returnLast = nullptr;
+      threadState.returnCount = 0;
+    };
+  }
+
+  /// @brief      Links a chain of blocks to the remote list. Called by any thread.
+  /// @param[in]  first: The first block of the chain.
+  /// @param[in]  last: The last block of the chain.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
+
+  void CRecordPool::pushRemote(block_t *first, block_t *last) noexcept
+  {
+    block_t *head = remoteList.load(std::memory_order_relaxed);
+
+    do
+    {
+      last->next = head;
+    }
+    while (!remoteList.compare_exchange_weak(head, first, std::memory_order_release, std::memory_order_relaxed));
+  }
+
+  /// @brief      Returns the number of slabs allocated by all the pools. Slabs are never released, so the memory held by the
+  ///             pools is slabs() * SLAB_BLOCKS * BLOCK_SIZE.
+  /// @returns    The number of slabs.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
+
+  std::size_t CRecordPool::slabs() noexcept
+  {
+    return slabCount.load(std::memory_order_relaxed);
+  }
+
+  /// @brief      Takes a block from the free list. When the free list is empty, the remote list becomes the free list. If
+  ///             that is also empty a slab is allocated. Called by the owner thread only.
+  /// @returns    The block.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-16/GGB - Counts the slabs.
+  /// @version    2026-10-16/GGB - Function created.
+
+  CRecordPool::block_t *CRecordPool::take()
+  {
+    static_assert(sizeof(block_t) <= HEADER_SIZE);
+
+    if (freeList == nullptr)
+    {
+      freeList = remoteList.exchange(nullptr, std::memory_order_acquire);
+    };
+
+    if (freeList == nullptr)
+    {
+      char *slab = static_cast<char *>(::operator new(BLOCK_SIZE * SLAB_BLOCKS));
+
+      slabCount.fetch_add(1, std::memory_order_relaxed);
+
+      for (std::size_t index = 0; index < SLAB_BLOCKS; index++)
+      {
+        block_t *block = reinterpret_cast<block_t *>(slab + index * BLOCK_SIZE);
+
+        block->owner = this;
+        block->next = freeList;
+        freeList = block;
+      };
+    };
+
+    block_t *returnValue = freeList;
+
+    freeList = returnValue->next;
+
+    return returnValue;
+  }
+
+  /// @brief      Returns the pool of the calling thread. The thread adopts the pool of an ended thread if there is one.
+  /// @returns    The pool.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-16/GGB - Function created.
+
+  CRecordPool &CRecordPool::threadPool()
+  {
+    if (threadState.pool == nullptr)
+    {
+      threadExit.started = true;
+
+      std::lock_guard<std::mutex> lock(abandonedMutex());
+
+      if (abandonedPools().empty())
+      {
+        threadState.pool = new CRecordPool;
+      }
+      else
+      {
+        threadState.pool = abandonedPools().back();
+        abandonedPools().pop_back();
+      };
+    };
+
+    return *threadState.pool;
+  }
+
+} // namespace
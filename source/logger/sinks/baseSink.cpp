@@ -27,15 +27,169 @@
 //
 // CLASSES INCLUDED:    CBaseSink
 //
-// HISTORY:             2024-02-05 GGB - Functions split from loggerCore into separate files
+// HISTORY:             2026-10-16 GGB - formatRecords() has the filter append to the buffer.
+//                      2026-10-16 GGB - Added writeRecords() and the flush policy.
+//                      2024-02-05 GGB - Functions split from loggerCore into separate files
 //
 //*********************************************************************************************************************************
 
 #include "include/logger/sinks/baseSink.h"
 
+// GCL header files
+
+#include "include/logger/records/debugRecord.h"
+
 namespace GCL::logger
 {
   CBaseSink::CBaseSink(std::shared_ptr<CBaseFilter> filt) : filter_(std::move(filt))
   {
   }
+
+  /// @brief      Flushes the sink.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
+
+  void CBaseSink::flush()
+  {
+    processFlush();
+    unflushed = false;
+    lastFlush = clock_type::now();
+  }
+
+  /// @brief      Returns the time that the sink must be flushed by.
+  /// @returns    The time, or std::nullopt if the sink does not need to be flushed.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
+
+  std::optional<CBaseSink::clock_type::time_point> CBaseSink::flushDue() const noexcept
+  {
+    std::optional<clock_type::time_point> returnValue;
+
+    if (unflushed && (flushPolicy_ != flushBatch))
+    {
+      returnValue = lastFlush + flushInterval_;
+    };
+
+    return returnValue;
+  }
+
+  /// @brief      Flushes the sink if the flush interval has passed.
+  /// @param[in]  now: The current time.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
+
+  void CBaseSink::flushIfDue(clock_type::time_point now)
+  {
+    std::optional<clock_type::time_point> due = flushDue();
+
+    if (due && (*due <= now))
+    {
+      flush();
+    };
+  }
+
+  /// @brief      Sets the flush policy.
+  /// @param[in]  policy: The flush policy.
+  /// @param[in]  interval: The longest time between writing a record and flushing it. (flushInterval, flushSeverity)
+  /// @param[in]  severities: The severities that flush the sink. (flushSeverity)
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
+
+  void CBaseSink::flushPolicy(EFlushPolicy policy, std::chrono::milliseconds interval, severityMask_t &&severities)
+  {
+    flushPolicy_ = policy;
+    flushInterval_ = interval;
+    flushSeverities = std::move(severities);
+  }
+
+  /// @brief      Formats a batch of records into the sink buffer. Each record is followed by a new line.
+  /// @param[in]  batch: The records to format.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-16/GGB - The filter appends the text to the buffer. (No temporary string for each record)
+  /// @version    2026-10-16/GGB - Function created.
+
+  void CBaseSink::formatRecords(recordBatch_t const &batch)
+  {
+    buffer_.clear();
+    for (auto const &record : batch)
+    {
+      if (filter_->appendRecordString(*record, buffer_))
+      {
+        buffer_ += '\n';
+      };
+    };
+  }
+
+  /// @brief      Determines if a batch holds a record with a flush severity.
+  /// @param[in]  batch: The batch to test.
+  /// @returns    true if the sink must be flushed.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
+
+  bool CBaseSink::hasFlushSeverity(recordBatch_t const &batch) const
+  {
+    bool returnValue = false;
+
+    for (auto iter = batch.begin(); !returnValue && (iter != batch.end()); iter++)
+    {
+      CDebugRecord const *debugRecord = dynamic_cast<CDebugRecord const *>(iter->get());
+
+      returnValue = (debugRecord != nullptr) && flushSeverities.contains(debugRecord->severity());
+    };
+
+    return returnValue;
+  }
+
+  /// @brief      Writes a batch of records. Sinks that do not override this write the records one at a time.
+  /// @param[in]  batch: The records to write.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
+
+  void CBaseSink::processWriteRecords(recordBatch_t const &batch)
+  {
+    for (auto const &record : batch)
+    {
+      writeRecord(*record);
+    };
+  }
+
+  /// @brief      Writes a batch of records and flushes the sink as required by the flush policy.
+  /// @param[in]  batch: The records to write.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
+
+  void CBaseSink::writeRecords(recordBatch_t const &batch)
+  {
+    if (!batch.empty())
+    {
+      processWriteRecords(batch);
+      unflushed = true;
+
+      switch (flushPolicy_)
+      {
+        case flushBatch:
+        {
+          flush();
+          break;
+        }
+        case flushSeverity:
+        {
+          if (hasFlushSeverity(batch))
+          {
+            flush();
+          }
+          else
+          {
+            flushIfDue(clock_type::now());
+          };
+          break;
+        }
+        case flushInterval:
+        {
+          flushIfDue(clock_type::now());
+          break;
+        }
+      };
+    };
+  }
 }
@@ -28,7 +28,9 @@
 //
 // CLASSES INCLUDED:    CLogger
 //
-// HISTORY:             2024-02-05 GGB - Rewrite to a flexible approach to enable additional functionality to be added.
+// HISTORY:             2026-10-16 GGB - Size rotation is checked before each record of a batch is written.
+//                      2026-10-16 GGB - Added processWriteRecords() and processFlush(). Size rotation uses the written size.
+//                      2024-02-05 GGB - Rewrite to a flexible approach to enable additional functionality to be added.
 //                      2023-11-16 GGB - Removed useage of boost::format.
 //                      2018-01-27 GGB - Removed all compression support. Do not see any way to make this truly system independent.
 //                      2018-01-26 GGB - Remove CFileSink default constructor.
@@ -148,6 +150,7 @@ namespace GCL::logger
     else
     {
       openLogFileName = logFileFullName;
+      logFileSize = std::filesystem::file_size(openLogFileName);
     };
   }
 
@@ -331,9 +334,93 @@ namespace GCL::logger
     return *this;
   }
 
+  /// @brief      Rotates the log file if it has reached the rotation size.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
+
+  void CFileSink::checkRotation()
+  {
+    if (rotationMethod == size)
+    {
+      if (logFileSize >= rotationSize)
+      {
+        rotateLogFile();
+      };
+    }
+    else if (rotationMethod == days)
+    {
+
+    };
+  }
+
+  /// @brief      Flushes the log file.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
+
+  void CFileSink::processFlush()
+  {
+    if (logFile.is_open())
+    {
+      logFile.flush();
+    };
+  }
+
+  /// @brief      Writes a batch of records to the log file with a single write. The file is flushed by the flush policy.
+  /// @details    With size rotation, the records before a record that would take the file over the rotation size are written,
+  ///             and the file is rotated before that record is written.
+  /// @param[in]  batch: The records to write.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Size rotation is checked before each record is written.
+  /// @version    2026-10-16/GGB - Function created.
+
+  void CFileSink::processWriteRecords(recordBatch_t const &batch)
+  {
+    if (!logFile.is_open())
+    {
+      openLogFile();
+    };
+
+    buffer_.clear();
+    for (auto const &record : batch)
+    {
+      std::size_t const start = buffer_.size();
+
+      if (filter_->appendRecordString(*record, buffer_))
+      {
+        buffer_ += '\n';
+
+        if ( (rotationMethod == size) && ((logFileSize + start) != 0) && (logFileSize + buffer_.size() > rotationSize) )
+        {
+          writeBuffer(start);
+          rotateLogFile();
+          buffer_.erase(0, start);
+        };
+      };
+    };
+
+    writeBuffer(buffer_.size());
+
+    checkRotation();
+  }
+
+  /// @brief      Writes the start of the buffer to the log file.
+  /// @param[in]  count: The number of characters to write.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
+
+  void CFileSink::writeBuffer(std::size_t count)
+  {
+    if (count != 0)
+    {
+      logFile.write(buffer_.data(), static_cast<std::streamsize>(count));
+      logFileSize += count;
+    };
+  }
+
   /// @brief      Function to write the message to the logFile.
   /// @param[in]  record: The record to write.
   /// @throws     None.
+  /// @version    2026-10-16/GGB - Size rotation uses the written size.
   /// @version    2015-06-01/GGB - Added functionality to rotate based on date.
   /// @version    2014-12-24/GGB - Function created.
 
@@ -344,30 +431,15 @@ namespace GCL::logger
       openLogFile();
     };
 
-    if (rotationMethod == daily)
-    {
-      std::time_t currentTime;
-    };
-
     std::optional<std::string> os = filter_->recordString(record);
 
     if (os)
     {
       logFile << *os << std::endl;
+      logFileSize += os->size() + 1;
     };
 
-    if (rotationMethod == size)
-    {
-      std::uintmax_t fileSize = std::filesystem::file_size(openLogFileName);
-      if (fileSize >= rotationSize)
-      {
-        rotateLogFile();
-      };
-    }
-    else if (rotationMethod == days)
-    {
-
-    };
+    checkRotation();
   }
 
 } // namespace
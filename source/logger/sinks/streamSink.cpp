@@ -31,7 +31,8 @@
 // CLASS HEIRARCHY:     CLoggerSink
 //                        - CStreamSink
 //
-// HISTORY:             2024-02-05 GGB - Rewrite to a flexible approach to enable additional functionality to be added.
+// HISTORY:             2026-10-16 GGB - Added processWriteRecords() and processFlush().
+//                      2024-02-05 GGB - Rewrite to a flexible approach to enable additional functionality to be added.
 //                      2015-09-22 GGB - AIRDAS 2015.09 release
 //                      2014-12-28 GGB - Development of class for "Observatory Weather System - Service"
 //
@@ -56,6 +57,30 @@ namespace GCL::logger
   {
   }
 
+  /// @brief      Flushes the stream.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
+
+  void CStreamSink::processFlush()
+  {
+    outputStream.flush();
+  }
+
+  /// @brief      Writes a batch of records to the stream with a single write. The stream is flushed by the flush policy.
+  /// @param[in]  batch: The records to write.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
+
+  void CStreamSink::processWriteRecords(recordBatch_t const &batch)
+  {
+    formatRecords(batch);
+
+    if (!buffer_.empty())
+    {
+      outputStream.write(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+    };
+  }
+
   /// @brief      This is the function to write the message to the stream.
   /// @param[in]  record: The record to write.
   /// @version    2024-02-06/GGB - Changed parameter to CBaseRecord.
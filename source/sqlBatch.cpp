@@ -0,0 +1,300 @@
+﻿//*********************************************************************************************************************************
+//
+// PROJECT:             General Class Library
+// FILE:                sqlBatch.cpp
+// SUBSYSTEM:           Database library
+// LANGUAGE:            C++20
+// TARGET OS:           None - Standard C++
+// NAMESPACE:           GCL
+// AUTHOR:              Gavin Blakeman.
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the General Class Library (GCL)
+//
+//                      GCL is free software: you can redistribute it and/or modify it under the terms of the GNU General
+//                      Public License as published by the Free Software Foundation, either version 2 of the License, or
+//                      (at your option) any later version.
+//
+//                      GCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+//                      implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//                      for more details.
+//
+//                      You should have received a copy of the GNU General Public License along with GCL.  If not,
+//                      see <http://www.gnu.org/licenses/>.
+//
+// OVERVIEW:            A batch of sqlWriter statements that is rendered as a single script. The script can be sent to the
+//                      database server in one round trip.
+//
+// CLASSES INCLUDED:    sqlBatch
+//
+// HISTORY:             2026-10-16 GGB - File Created.
+//
+//*********************************************************************************************************************************
+
+#include "include/sqlBatch.h"
+
+  // Standard C++ library header files
+
+#include <iterator>
+
+  // GCL library header files
+
+#include "include/sqlBindBuffer.h"
+
+namespace GCL
+{
+  /// @brief      Constructs an empty batch.
+  /// @param[in]  dialect: The dialect of the batch. Statements added to the batch are changed to this dialect.
+  /// @param[in]  maxInsertRows: The maximum number of rows in a merged insert. Zero for no limit.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
+
+  sqlBatch::sqlBatch(sqlWriter::EDialect dialect, std::size_t maxInsertRows) : dialect_(dialect), maxInsertRows_(maxInsertRows)
+  {
+  }
+
+  /// @brief      Adds a statement to the batch. An insert is merged into the previous statement if possible.
+  /// @param[in]  statement: The statement to add.
+  /// @returns    (*this)
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-16/GGB - Function created.
+
+  sqlBatch &sqlBatch::add(sqlWriter &&statement)
+  {
+    statement.setDialect(dialect_);
+
+    if (!merge(statement))
+    {
+      entries_.emplace_back(std::in_place_type<sqlWriter>, std::move(statement));
+    };
+
+    return *this;
+  }
+
+  /// @brief      Appends a savepoint statement to the script.
+  /// @param[out] buffer: The buffer to append to.
+  /// @param[in]  sp: The savepoint.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-16/GGB - Function created.
+
+  void sqlBatch::appendSavepoint(std::string &buffer, savepoint_t const &sp) const
+  {
+    if (!sp.release)
+    {
+      buffer += (dialect_ == sqlWriter::MICROSOFT) ? "SAVE TRANSACTION " : "SAVEPOINT ";
+      buffer += sp.name;
+      buffer += ";\n";
+    }
+    else if ((dialect_ == sqlWriter::MYSQL) || (dialect_ == sqlWriter::POSTGRE))
+    {
+      buffer += "RELEASE SAVEPOINT ";
+      buffer += sp.name;
+      buffer += ";\n";
+    };
+  }
+
+  /// @brief      Appends a statement to the script. Prepared inserts have one row of placeholders for each row of values.
+  /// @param[out] buffer: The buffer to append to.
+  /// @param[in]  statement: The statement.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-16/GGB - Function created.
+
+  void sqlBatch::appendStatement(std::string &buffer, sqlWriter const &statement) const
+  {
+    if ( (statement.queryType == sqlWriter::qt_insert) && statement.preparedStatement_ &&
+         std::holds_alternative<sqlWriter::valueStorage_t>(statement.insertValue) )
+    {
+      std::size_t const rows = std::get<sqlWriter::valueStorage_t>(statement.insertValue).size();
+
+      statement.createInsertHead(buffer);
+      buffer += "VALUES ";
+      for (std::size_t row = 0; row < rows; row++)
+      {
+        buffer += (row == 0) ? "(" : ", (";
+        for (std::size_t column = 0; column < statement.selectFields.size(); column++)
+        {
+          buffer += (column == 0) ? "?" : ", ?";
+        };
+        buffer += ')';
+      };
+      statement.createReturningClause(buffer);
+    }
+    else
+    {
+      statement.appendTo(buffer);
+    };
+
+    while (!buffer.empty() && (buffer.back() == ' '))
+    {
+      buffer.pop_back();
+    };
+    if (buffer.back() != ';')       // MICROSOFT MERGE statements are already terminated.
+    {
+      buffer += ';';
+    };
+    buffer += '\n';
+  }
+
+  /// @brief      Renders the batch as a script. Each statement is terminated with a semicolon and a newline.
+  /// @param[out] buffer: The buffer to append the script to.
+  /// @throws     std::bad_alloc
+  /// @throws     GCL::runtime_error
+  /// @version    2026-10-16/GGB - Function created.
+
+  void sqlBatch::appendTo(std::string &buffer) const
+  {
+    switch (dialect_)
+    {
+      case sqlWriter::MYSQL:
+      {
+        buffer += transaction_ ? "START TRANSACTION;\n" : "";
+        break;
+      };
+      case sqlWriter::POSTGRE:
+      {
+        buffer += transaction_ ? "BEGIN;\n" : "";
+        break;
+      };
+      case sqlWriter::MICROSOFT:
+      {
+        buffer += transaction_ ? "BEGIN TRANSACTION;\n" : "";
+        break;
+      };
+      case sqlWriter::ORACLE:
+      {
+        buffer += "BEGIN\n";      // ORACLE transactions start implicitly. The block allows several statements.
+        break;
+      };
+    };
+
+    for (auto const &entry : entries_)
+    {
+      if (std::holds_alternative<sqlWriter>(entry))
+      {
+        appendStatement(buffer, std::get<sqlWriter>(entry));
+      }
+      else
+      {
+        appendSavepoint(buffer, std::get<savepoint_t>(entry));
+      };
+    };
+
+    if (transaction_)
+    {
+      buffer += (dialect_ == sqlWriter::MICROSOFT) ? "COMMIT TRANSACTION;\n" : "COMMIT;\n";
+    };
+    if (dialect_ == sqlWriter::ORACLE)
+    {
+      buffer += "END;\n";
+    };
+  }
+
+  /// @brief      Fills a bind buffer with the values of the placeholders of all the statements, in statement order.
+  /// @param[out] bb: The bind buffer to fill. The buffer is not cleared first.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-16/GGB - Function created.
+
+  void sqlBatch::bindValues(sqlBindBuffer &bb) const
+  {
+    for (auto const &entry : entries_)
+    {
+      if (std::holds_alternative<sqlWriter>(entry))
+      {
+        std::get<sqlWriter>(entry).bindValues(bb);
+      };
+    };
+  }
+
+  /// @brief      Removes all the statements and savepoints.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
+
+  void sqlBatch::clear() noexcept
+  {
+    entries_.clear();
+  }
+
+  /// @brief      Merges an insert into the previous statement. The statements must both be inserts into the same table with
+  ///             the same columns and row values, without a RETURNING clause. ORACLE does not support multi-row VALUES, so
+  ///             ORACLE inserts are not merged.
+  /// @param[in]  statement: The statement to merge. The rows are moved out of the statement if it is merged.
+  /// @returns    true if the statement was merged.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-16/GGB - ORACLE inserts are not merged.
+  /// @version    2026-10-16/GGB - Function created.
+
+  bool sqlBatch::merge(sqlWriter &statement)
+  {
+    bool returnValue = false;
+
+    if ( (dialect_ != sqlWriter::ORACLE) && !entries_.empty() && std::holds_alternative<sqlWriter>(entries_.back()) )
+    {
+      sqlWriter &previous = std::get<sqlWriter>(entries_.back());
+
+      if ( (previous.queryType == sqlWriter::qt_insert) && (statement.queryType == sqlWriter::qt_insert) &&
+           previous.returningFields_.empty() && statement.returningFields_.empty() &&
+           (previous.preparedStatement_ == statement.preparedStatement_) &&
+           (previous.insertTable == statement.insertTable) &&
+           std::holds_alternative<sqlWriter::valueStorage_t>(previous.insertValue) &&
+           std::holds_alternative<sqlWriter::valueStorage_t>(statement.insertValue) )
+      {
+        sqlWriter::valueStorage_t &previousRows = std::get<sqlWriter::valueStorage_t>(previous.insertValue);
+        sqlWriter::valueStorage_t &rows = std::get<sqlWriter::valueStorage_t>(statement.insertValue);
+        std::string previousHead;
+        std::string head;
+
+        previous.createInsertHead(previousHead);
+        statement.createInsertHead(head);
+
+        if ( (previousHead == head) && ((maxInsertRows_ == 0) || (previousRows.size() + rows.size() <= maxInsertRows_)) )
+        {
+          previousRows.insert(previousRows.end(), std::make_move_iterator(rows.begin()), std::make_move_iterator(rows.end()));
+          returnValue = true;
+        };
+      };
+    };
+
+    return returnValue;
+  }
+
+  /// @brief      Adds a release of a savepoint. Nothing is rendered for ORACLE and MICROSOFT, which do not release savepoints.
+  /// @param[in]  name: The savepoint name.
+  /// @returns    (*this)
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-16/GGB - Function created.
+
+  sqlBatch &sqlBatch::releaseSavepoint(std::string const &name)
+  {
+    entries_.emplace_back(savepoint_t{name, true});
+
+    return *this;
+  }
+
+  /// @brief      Adds a savepoint. Statements after a savepoint are not merged with statements before it.
+  /// @param[in]  name: The savepoint name.
+  /// @returns    (*this)
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-16/GGB - Function created.
+
+  sqlBatch &sqlBatch::savepoint(std::string const &name)
+  {
+    entries_.emplace_back(savepoint_t{name, false});
+
+    return *this;
+  }
+
+  /// @brief      Renders the batch as a script.
+  /// @returns    The script.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-16/GGB - Function created.
+
+  std::string sqlBatch::string() const
+  {
+    std::string returnValue;
+
+    appendTo(returnValue);
+    return returnValue;
+  }
+
+} // namespace GCL
@@ -0,0 +1,263 @@
+﻿//*********************************************************************************************************************************
+//
+// PROJECT:             General Class Library
+// FILE:                sqlBindBuffer.cpp
+// SUBSYSTEM:           Database library
+// LANGUAGE:            C++20
+// TARGET OS:           None - Standard C++
+// NAMESPACE:           GCL
+// AUTHOR:              Gavin Blakeman.
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the General Class Library (GCL)
+//
+//                      GCL is free software: you can redistribute it and/or modify it under the terms of the GNU General
+//                      Public License as published by the Free Software Foundation, either version 2 of the License, or
+//                      (at your option) any later version.
+//
+//                      GCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+//                      implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//                      for more details.
+//
+//                      You should have received a copy of the GNU General Public License along with GCL.  If not,
+//                      see <http://www.gnu.org/licenses/>.
+//
+// OVERVIEW:            A contiguous buffer of bind values for a prepared statement. The buffer is laid out so that it can be
+//                      handed to a database driver without converting each parameter.
+//
+// CLASSES INCLUDED:    sqlBindBuffer
+//
+// HISTORY:             2026-10-16 GGB - Dates and times are written with sqlLiteral.h.
+//                      2026-10-16 GGB - Added fixedDecimal_t parameters.
+//                      2026-10-16 GGB - Added typed push_back() for column-wise values.
+//                      2026-10-16 GGB - File Created.
+//
+//*********************************************************************************************************************************
+
+#include "include/sqlBindBuffer.h"
+
+  // Standard C++ library header files
+
+#include <iterator>
+
+  // Miscellaneous library header files
+
+#include "boost/locale.hpp"
+
+  // GCL Library header files
+
+#include "include/sqlLiteral.h"
+
+namespace GCL
+{
+  /* Writes a parameter into the bind buffer. */
+  struct parameter_to_bind
+  {
+    sqlBindBuffer &bb;
+
+    void operator()(std::uint8_t const &p) { bb.appendNumber(sqlWriter::PT_U8, p); }
+    void operator()(std::uint16_t const &p) { bb.appendNumber(sqlWriter::PT_U16, p); }
+    void operator()(std::uint32_t const &p) { bb.appendNumber(sqlWriter::PT_U32, p); }
+    void operator()(std::uint64_t const &p) { bb.appendNumber(sqlWriter::PT_U64, p); }
+    void operator()(std::int8_t const &p) { bb.appendNumber(sqlWriter::PT_I8, p); }
+    void operator()(std::int16_t const &p) { bb.appendNumber(sqlWriter::PT_I16, p); }
+    void operator()(std::int32_t const &p) { bb.appendNumber(sqlWriter::PT_I32, p); }
+    void operator()(std::int64_t const &p) { bb.appendNumber(sqlWriter::PT_I64, p); }
+    void operator()(float const &p) { bb.appendNumber(sqlWriter::PT_FLOAT, p); }
+    void operator()(double const &p) { bb.appendNumber(sqlWriter::PT_DOUBLE, p); }
+    void operator()(date_t const &p)
+    {
+      bb.beginText(sqlWriter::PT_DATE);
+      appendDateLiteral(bb.arena_, p.date());
+      bb.endText();
+    }
+    void operator()(time_t const &p)
+    {
+      bb.beginText(sqlWriter::PT_TIME);
+      appendTimeLiteral(bb.arena_, p.time());
+      bb.endText();
+    }
+    void operator()(dateTime_t const &p)
+    {
+      bb.beginText(sqlWriter::PT_DATETIME);
+      appendDateTimeLiteral(bb.arena_, p.dateTime());
+      bb.endText();
+    }
+    void operator()(decimal_t const &p) { bb.appendText(sqlWriter::PT_DECIMAL, p.str(0, std::ios::fixed)); }
+    void operator()(fixedDecimal_t const &p)
+    {
+      char text[fixedDecimal_t::MAX_CHARS + 256];
+      auto const [end, ec] = p.to_chars(text, text + sizeof(text));
+
+      bb.appendText(sqlWriter::PT_DECIMAL, std::string_view(text, static_cast<std::size_t>(end - text)));
+    }
+    void operator()(std::string const &p) { bb.appendText(sqlWriter::PT_STRING, p); }
+    void operator()(sqlWriter::bindValue_t const &) { bb.push_null(); }
+  };
+
+  /// @brief      Constructor for the class.
+  /// @param[in]  d: The dialect of the database the buffer will be passed to.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
+
+  sqlBindBuffer::sqlBindBuffer(sqlWriter::EDialect d) : dialect_(d)
+  {
+  }
+
+  /// @brief      Appends a text value to the arena.
+  /// @param[in]  type: The type tag of the value.
+  /// @param[in]  value: The text to append.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-16/GGB - Function created.
+
+  void sqlBindBuffer::appendText(parameterType_t type, std::string_view value)
+  {
+    beginText(type);
+    arena_.append(value);
+    endText();
+  }
+
+  /// @brief      Starts a text value. The text is then written to the end of the arena and endText() is called.
+  /// @param[in]  type: The type tag of the value.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-16/GGB - Function created.
+
+  void sqlBindBuffer::beginText(parameterType_t type)
+  {
+    types_.push_back(type);
+    slots_.push_back(arena_.size());
+    lengths_.push_back(0);
+    formats_.push_back(FMT_TEXT);
+  }
+
+  /// @brief      Returns a pointer to the value of a parameter.
+  /// @param[in]  index: The parameter index.
+  /// @returns    Pointer to the value slot (binary) or the arena (text). nullptr for NULL parameters.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
+
+  void const *sqlBindBuffer::buffer(std::size_t index) const noexcept
+  {
+    void const *returnValue = nullptr;
+
+    if (types_[index] != sqlWriter::PT_NONE)
+    {
+      if (formats_[index] == FMT_TEXT)
+      {
+        returnValue = arena_.data() + slots_[index];
+      }
+      else
+      {
+        returnValue = &slots_[index];
+      };
+    };
+
+    return returnValue;
+  }
+
+  /// @brief      Removes all the parameters. The capacity of the buffer is retained.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
+
+  void sqlBindBuffer::clear() noexcept
+  {
+    types_.clear();
+    slots_.clear();
+    lengths_.clear();
+    formats_.clear();
+    arena_.clear();
+    pointers_.clear();
+  }
+
+  /// @brief      Completes a text value started with beginText().
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-16/GGB - Function created.
+
+  void sqlBindBuffer::endText()
+  {
+    lengths_.back() = static_cast<int>(arena_.size() - slots_.back());
+    arena_ += '\0';
+  }
+
+  /// @brief      Determines if a parameter is an unsigned integer. (MYSQL_BIND::is_unsigned)
+  /// @param[in]  index: The parameter index.
+  /// @returns    true if the parameter is an unsigned integer.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
+
+  bool sqlBindBuffer::isUnsigned(std::size_t index) const noexcept
+  {
+    return (types_[index] >= sqlWriter::PT_U8) && (types_[index] <= sqlWriter::PT_U64);
+  }
+
+  /// @brief      Returns the array of value pointers. This can be passed as the paramValues argument of PQexecParams().
+  /// @returns    Pointer to the array of value pointers. NULL parameters have a nullptr entry.
+  /// @throws     std::bad_alloc
+  /// @note       The pointers are invalidated if further parameters are added to the buffer.
+  /// @version    2026-10-16/GGB - Function created.
+
+  char const * const *sqlBindBuffer::paramValues() const
+  {
+    pointers_.resize(types_.size());
+
+    for (std::size_t index = 0; index < types_.size(); index++)
+    {
+      pointers_[index] = static_cast<char const *>(buffer(index));
+    };
+
+    return pointers_.data();
+  }
+
+  /// @brief      Appends a NULL parameter.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-16/GGB - Function created.
+
+  void sqlBindBuffer::push_null()
+  {
+    types_.push_back(sqlWriter::PT_NONE);
+    slots_.push_back(0);
+    lengths_.push_back(0);
+    formats_.push_back(FMT_TEXT);
+  }
+
+  /// @brief      Appends a parameter to the buffer.
+  /// @param[in]  p: The parameter to append. Bind values are appended as NULL.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-16/GGB - Function created.
+
+  void sqlBindBuffer::push_back(sqlWriter::parameter_t const &p)
+  {
+    std::visit(parameter_to_bind{*this}, p);
+  }
+
+  /// @brief      Reserves space in the buffer.
+  /// @param[in]  parameters: The number of parameters.
+  /// @param[in]  arenaBytes: The number of bytes of text.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-16/GGB - Function created.
+
+  void sqlBindBuffer::reserve(std::size_t parameters, std::size_t arenaBytes)
+  {
+    types_.reserve(parameters);
+    slots_.reserve(parameters);
+    lengths_.reserve(parameters);
+    formats_.reserve(parameters);
+    pointers_.reserve(parameters);
+    arena_.reserve(arenaBytes);
+  }
+
+  /// @brief      Returns the text of a text format parameter.
+  /// @param[in]  index: The parameter index.
+  /// @returns    The text of the parameter.
+  /// @throws     GCL::CRuntimeAssert
+  /// @version    2026-10-16/GGB - Function created.
+
+  std::string_view sqlBindBuffer::text(std::size_t index) const
+  {
+    RUNTIME_ASSERT(formats_[index] == FMT_TEXT, boost::locale::translate("Bind parameter is not a text parameter."));
+
+    return std::string_view(arena_).substr(slots_[index], lengths_[index]);
+  }
+
+} // namespace GCL
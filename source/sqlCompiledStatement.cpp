@@ -0,0 +1,130 @@
+﻿//*********************************************************************************************************************************
+//
+// PROJECT:             General Class Library
+// FILE:                sqlCompiledStatement.cpp
+// SUBSYSTEM:           Database library
+// LANGUAGE:            C++20
+// TARGET OS:           None - Standard C++
+// NAMESPACE:           GCL
+// AUTHOR:              Gavin Blakeman.
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the General Class Library (GCL)
+//
+//                      GCL is free software: you can redistribute it and/or modify it under the terms of the GNU General
+//                      Public License as published by the Free Software Foundation, either version 2 of the License, or
+//                      (at your option) any later version.
+//
+//                      GCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+//                      implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//                      for more details.
+//
+//                      You should have received a copy of the GNU General Public License along with GCL.  If not,
+//                      see <http://www.gnu.org/licenses/>.
+//
+// OVERVIEW:            A compiled prepared statement. The SQL text and the placeholder slots are fixed when the statement is
+//                      compiled. Values are then bound into the slots without walking the query tree.
+//
+// CLASSES INCLUDED:    sqlCompiledStatement
+//
+// HISTORY:             2026-10-16 GGB - Added fixedDecimal_t slot values.
+//                      2026-10-16 GGB - File Created.
+//
+//*********************************************************************************************************************************
+
+#include "include/sqlCompiledStatement.h"
+
+  // Standard C++ library header files
+
+#include <algorithm>
+
+  // Miscellaneous library header files
+
+#include "boost/locale.hpp"
+
+namespace GCL
+{
+  /// @brief      Constructor for the class. Normally only called by sqlWriter::compile().
+  /// @param[in]  text: The final text of the prepared statement.
+  /// @param[in]  types: The types of the placeholders, in the order they appear in the text.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-16/GGB - Function created.
+
+  sqlCompiledStatement::sqlCompiledStatement(std::string &&text, std::vector<parameterType_t> &&types)
+    : sqlText(std::move(text)), slotTypes(std::move(types)), slotValues(slotTypes.size())
+  {
+  }
+
+  /// @brief      Binds a value to a slot.
+  /// @param[in]  index: The slot index. (Zero based)
+  /// @param[in]  value: The value to bind.
+  /// @returns    (*this)
+  /// @throws     GCL::CRuntimeAssert
+  /// @throws     GCL::runtime_error
+  /// @version    2026-10-16/GGB - Function created.
+
+  sqlCompiledStatement &sqlCompiledStatement::bind(std::size_t index, slotValue_t const &value)
+  {
+    RUNTIME_ASSERT(index < slotTypes.size(), boost::locale::translate("Placeholder index out of range."));
+
+    parameterType_t const valueType = std::holds_alternative<fixedDecimal_t>(value) ? sqlWriter::PT_DECIMAL
+                                                                                    : static_cast<parameterType_t>(value.index());
+
+    if ( (slotTypes[index] != sqlWriter::PT_NONE) && (valueType != slotTypes[index]) )
+    {
+      RUNTIME_ERROR(boost::locale::translate("Bound value type does not match the placeholder type."));
+    };
+
+    slotValues[index] = value;
+
+    return *this;
+  }
+
+  /// @brief      Clears all the bound values. The text and the slot types are not changed.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
+
+  void sqlCompiledStatement::clearBindings() noexcept
+  {
+    std::fill(slotValues.begin(), slotValues.end(), slotValue_t{});
+  }
+
+  /// @brief      Determines if a value has been bound to every slot.
+  /// @returns    true if all slots are bound.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
+
+  bool sqlCompiledStatement::isBound() const noexcept
+  {
+    return std::none_of(slotValues.begin(), slotValues.end(),
+                        [](slotValue_t const &v) { return std::holds_alternative<std::monostate>(v); });
+  }
+
+  /// @brief      Returns the value bound to a slot.
+  /// @param[in]  index: The slot index. (Zero based)
+  /// @returns    The bound value. std::monostate if no value has been bound.
+  /// @throws     GCL::CRuntimeAssert
+  /// @version    2026-10-16/GGB - Function created.
+
+  sqlCompiledStatement::slotValue_t const &sqlCompiledStatement::slot(std::size_t index) const
+  {
+    RUNTIME_ASSERT(index < slotValues.size(), boost::locale::translate("Placeholder index out of range."));
+
+    return slotValues[index];
+  }
+
+  /// @brief      Returns the type of a slot.
+  /// @param[in]  index: The slot index. (Zero based)
+  /// @returns    The type of the slot. PT_NONE for named bind values.
+  /// @throws     GCL::CRuntimeAssert
+  /// @version    2026-10-16/GGB - Function created.
+
+  sqlCompiledStatement::parameterType_t sqlCompiledStatement::slotType(std::size_t index) const
+  {
+    RUNTIME_ASSERT(index < slotTypes.size(), boost::locale::translate("Placeholder index out of range."));
+
+    return slotTypes[index];
+  }
+
+} // namespace GCL
@@ -0,0 +1,230 @@
+//*********************************************************************************************************************************
+//
+// PROJECT:             General Class Library
+// FILE:                sqlDatabaseMap.cpp
+// SUBSYSTEM:           Database library
+// LANGUAGE:            C++20
+// TARGET OS:           None - Standard C++
+// NAMESPACE:           GCL
+// AUTHOR:              Gavin Blakeman.
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the General Class Library (GCL)
+//
+//                      GCL is free software: you can redistribute it and/or modify it under the terms of the GNU General
+//                      Public License as published by the Free Software Foundation, either version 2 of the License, or
+//                      (at your option) any later version.
+//
+//                      GCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+//                      implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//                      for more details.
+//
+//                      You should have received a copy of the GNU General Public License along with GCL.  If not,
+//                      see <http://www.gnu.org/licenses/>.
+//
+// OVERVIEW:            An immutable snapshot of the table and column name mapping used by sqlWriter. The snapshot is shared
+//                      between sqlWriter instances.
+//
+// CLASSES INCLUDED:    sqlDatabaseMap
+//
+// HISTORY:             2026-10-16 GGB - File Created.
+//
+//*********************************************************************************************************************************
+
+#include "include/sqlDatabaseMap.h"
+
+  // Standard C++ library header files
+
+#include <atomic>
+#include <bit>
+#include <functional>
+
+namespace GCL
+{
+  /// @brief      Constructs the snapshot and builds the lookup indexes.
+  /// @param[in]  definition: The table and column mapping. Only names with a mapped name are indexed.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-16/GGB - Function created.
+
+  sqlDatabaseMap::sqlDatabaseMap(TDatabaseMap &&definition) : definition_(std::move(definition))
+  {
+    static std::atomic<std::uint64_t> nextSerial = 1;
+
+    std::size_t tableCount = 0;
+    std::size_t columnCount = 0;
+    std::map<std::string_view, std::string_view> unqualified;
+    std::map<std::string_view, bool> conflicted;
+
+    serial_ = nextSerial++;
+
+    for (auto const &[tableName, table] : definition_)
+    {
+      tableCount++;
+      columnCount += table.columnData.size();
+    };
+    reserve(tables_, tableCount);
+    reserve(columns_, columnCount);
+
+    for (auto const &[tableName, table] : definition_)
+    {
+      if (!table.tableName.second.empty())
+      {
+        insert(tables_, entry_t{hash(tableName, {}), tableName, {}, table.tableName.second});
+      };
+
+      for (auto const &[columnName, column] : table.columnData)
+      {
+        if (!column.columnName.second.empty())
+        {
+          insert(columns_, entry_t{hash(tableName, columnName), tableName, columnName, column.columnName.second});
+
+          auto const [iter, inserted] = unqualified.emplace(columnName, column.columnName.second);
+          if (!inserted && (iter->second != column.columnName.second))
+          {
+            conflicted[columnName] = true;
+          };
+        };
+      };
+    };
+
+    reserve(unqualified_, unqualified.size());
+    for (auto const &[columnName, mappedName] : unqualified)
+    {
+      if (!conflicted.contains(columnName))
+      {
+        insert(unqualified_, entry_t{hash({}, columnName), {}, columnName, mappedName});
+      };
+    };
+  }
+
+  /// @brief      Returns the mapped name of a column in a table.
+  /// @param[in]  table: The table name.
+  /// @param[in]  column: The column name.
+  /// @returns    The mapped name, or column if the column is not mapped.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
+
+  std::string_view sqlDatabaseMap::columnName(std::string_view table, std::string_view column) const noexcept
+  {
+    entry_t const *entry = find(columns_, table, column);
+
+    return entry ? entry->mapped : column;
+  }
+
+  /// @brief      Returns the mapped name of a column. The column may be qualified. (table.column)
+  ///             An unqualified column is mapped if it has the same mapped name in every table that maps it.
+  /// @param[in]  column: The column name.
+  /// @returns    The mapped name, or column if the column is not mapped.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
+
+  std::string_view sqlDatabaseMap::columnName(std::string_view column) const noexcept
+  {
+    std::size_t const point = column.find('.');
+    entry_t const *entry;
+
+    if (point != std::string_view::npos)
+    {
+      entry = find(columns_, column.substr(0, point), column.substr(point + 1));
+    }
+    else
+    {
+      entry = find(unqualified_, {}, column);
+    };
+
+    return entry ? entry->mapped : column;
+  }
+
+  /// @brief      Finds an entry in an index.
+  /// @param[in]  index: The index to search.
+  /// @param[in]  table: The table name of the key.
+  /// @param[in]  column: The column name of the key.
+  /// @returns    The entry, or nullptr if there is no entry for the key.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
+
+  sqlDatabaseMap::entry_t const *sqlDatabaseMap::find(index_t const &index, std::string_view table,
+                                                      std::string_view column) noexcept
+  {
+    entry_t const *returnValue = nullptr;
+
+    if (!index.empty())
+    {
+      std::uint64_t const h = hash(table, column);
+      std::size_t const mask = index.size() - 1;
+
+      for (std::size_t slot = h & mask; !index[slot].mapped.empty(); slot = (slot + 1) & mask)
+      {
+        if ((index[slot].hash == h) && (index[slot].table == table) && (index[slot].column == column))
+        {
+          returnValue = &index[slot];
+          break;
+        };
+      };
+    };
+
+    return returnValue;
+  }
+
+  /// @brief      Hashes a (table, column) key.
+  /// @param[in]  table: The table name.
+  /// @param[in]  column: The column name.
+  /// @returns    The hash value.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
+
+  std::uint64_t sqlDatabaseMap::hash(std::string_view table, std::string_view column) noexcept
+  {
+    std::uint64_t returnValue = std::hash<std::string_view>{}(table);
+
+    returnValue ^= std::hash<std::string_view>{}(column) + 0x9e3779b97f4a7c15ull + (returnValue << 6) + (returnValue >> 2);
+    return returnValue;
+  }
+
+  /// @brief      Inserts an entry into an index. The index must have a free slot.
+  /// @param[in]  index: The index.
+  /// @param[in]  entry: The entry to insert.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
+
+  void sqlDatabaseMap::insert(index_t &index, entry_t const &entry) noexcept
+  {
+    std::size_t const mask = index.size() - 1;
+    std::size_t slot = entry.hash & mask;
+
+    while (!index[slot].mapped.empty())
+    {
+      slot = (slot + 1) & mask;
+    };
+    index[slot] = entry;
+  }
+
+  /// @brief      Sizes an index so that it is never more than half full.
+  /// @param[in]  index: The index.
+  /// @param[in]  count: The maximum number of entries.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-16/GGB - Function created.
+
+  void sqlDatabaseMap::reserve(index_t &index, std::size_t count)
+  {
+    if (count != 0)
+    {
+      index.resize(std::bit_ceil(count * 2));
+    };
+  }
+
+  /// @brief      Returns the mapped name of a table.
+  /// @param[in]  table: The table name.
+  /// @returns    The mapped name, or table if the table is not mapped.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
+
+  std::string_view sqlDatabaseMap::tableName(std::string_view table) const noexcept
+  {
+    entry_t const *entry = find(tables_, table, {});
+
+    return entry ? entry->mapped : table;
+  }
+
+} // namespace GCL
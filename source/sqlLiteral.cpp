@@ -0,0 +1,277 @@
+﻿//*********************************************************************************************************************************
+//
+// PROJECT:             General Class Library
+// FILE:                sqlLiteral.cpp
+// SUBSYSTEM:           Database library
+// LANGUAGE:            C++20
+// TARGET OS:           None - Standard C++
+// NAMESPACE:           GCL
+// AUTHOR:              Gavin Blakeman.
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the General Class Library (GCL)
+//
+//                      GCL is free software: you can redistribute it and/or modify it under the terms of the GNU General
+//                      Public License as published by the Free Software Foundation, either version 2 of the License, or
+//                      (at your option) any later version.
+//
+//                      GCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+//                      implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//                      for more details.
+//
+//                      You should have received a copy of the GNU General Public License along with GCL.  If not,
+//                      see <http://www.gnu.org/licenses/>.
+//
+// OVERVIEW:            Functions to write SQL literal values directly into an output buffer. The functions do not use the
+//                      locale, do not convert through std::tm and do not allocate other than growing the output buffer.
+//
+// CLASSES INCLUDED:    None
+//
+// HISTORY:             2026-10-16 GGB - Added appendStringLiteral().
+//                      2026-10-16 GGB - File Created.
+//
+//*********************************************************************************************************************************
+
+#include "include/sqlLiteral.h"
+
+  // Standard C++ library header files
+
+#include <cstdint>
+#include <cstring>
+
+namespace GCL
+{
+  /* Returns a word with the high bit set in each byte of word that equals c. The test is exact for "any byte equals c", but
+   * bytes above a matching byte may also be flagged. Callers only use the result to decide if the word needs a byte scan.
+   */
+  static inline std::uint64_t matchByte(std::uint64_t word, unsigned char c) noexcept
+  {
+    constexpr std::uint64_t ONES = 0x0101010101010101ull;
+    constexpr std::uint64_t HIGHS = 0x8080808080808080ull;
+    std::uint64_t const x = word ^ (ONES * c);
+
+    return (x - ONES) & ~x & HIGHS;
+  }
+
+  /* Determines if a character needs escaping in a string literal. */
+  static inline bool isSpecial(char c, EStringLiteral style) noexcept
+  {
+    switch (c)
+    {
+      case '\'':
+        return true;
+      case '\\':
+        return (style != SL_STANDARD);
+      case '"':
+      case '\0':
+      case '\n':
+      case '\r':
+      case '\x1a':
+        return (style == SL_MYSQL);
+      default:
+        return false;
+    };
+  }
+
+  /* Returns the index of the next character that needs escaping, or text.size(). Eight bytes are tested at a time, so long
+   * runs of clean text are skipped with a few instructions per word.
+   */
+  static std::size_t findSpecial(std::string_view text, std::size_t index, EStringLiteral style) noexcept
+  {
+    while (index + sizeof(std::uint64_t) <= text.size())
+    {
+      std::uint64_t word;
+      std::memcpy(&word, text.data() + index, sizeof(word));
+
+      std::uint64_t mask = matchByte(word, '\'');
+      if (style != SL_STANDARD)
+      {
+        mask |= matchByte(word, '\\');
+      };
+      if (style == SL_MYSQL)
+      {
+        mask |= matchByte(word, '"') | matchByte(word, '\0') | matchByte(word, '\n') | matchByte(word, '\r') |
+                matchByte(word, '\x1a');
+      };
+      if (mask != 0)
+      {
+        break;
+      };
+      index += sizeof(std::uint64_t);
+    };
+
+    while ((index < text.size()) && !isSpecial(text[index], style))
+    {
+      index++;
+    };
+
+    return index;
+  }
+
+  /* Writes a two digit number. (00 - 99) */
+  static inline char *writeTwoDigits(char *output, unsigned value) noexcept
+  {
+    *output++ = static_cast<char>('0' + value / 10);
+    *output++ = static_cast<char>('0' + value % 10);
+    return output;
+  }
+
+  /* Writes the date part (YYYY-MM-DD) of a number of days since 1970-01-01.
+   * This is the civil_from_days() algorithm of Howard Hinnant. Years are counted from 0000-03-01 in 400 year eras so that
+   * the leap day is the last day of each year.
+   */
+  static char *writeDate(char *output, std::int64_t days) noexcept
+  {
+    days += 719468;                                                                 // Shift the epoch to 0000-03-01
+    std::int64_t const era = (days >= 0 ? days : days - 146096) / 146097;
+    unsigned const dayOfEra = static_cast<unsigned>(days - era * 146097);           // [0, 146096]
+    unsigned const yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;   // [0, 399]
+    unsigned const dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);               // [0, 365]
+    unsigned const mp = (5 * dayOfYear + 2) / 153;                                  // [0, 11] March = 0
+    unsigned const day = dayOfYear - (153 * mp + 2) / 5 + 1;                        // [1, 31]
+    unsigned const month = (mp < 10) ? mp + 3 : mp - 9;                             // [1, 12]
+    std::int64_t const year = static_cast<std::int64_t>(yearOfEra) + era * 400 + ((month <= 2) ? 1 : 0);
+
+    if ((year >= 0) && (year <= 9999))
+    {
+      output = writeTwoDigits(output, static_cast<unsigned>(year / 100));
+      output = writeTwoDigits(output, static_cast<unsigned>(year % 100));
+    }
+    else
+    {
+      output = std::to_chars(output, output + 24, year).ptr;
+    };
+    *output++ = '-';
+    output = writeTwoDigits(output, month);
+    *output++ = '-';
+    return writeTwoDigits(output, day);
+  }
+
+  /* Writes the time part (HH:MM:SS) of a number of seconds since midnight. */
+  static char *writeTime(char *output, unsigned seconds) noexcept
+  {
+    output = writeTwoDigits(output, seconds / 3600);
+    *output++ = ':';
+    output = writeTwoDigits(output, (seconds / 60) % 60);
+    *output++ = ':';
+    return writeTwoDigits(output, seconds % 60);
+  }
+
+  /* Splits a time point into whole days since the epoch and seconds since midnight. Times before the epoch are floored. */
+  static void splitTimePoint(timePoint_t tp, std::int64_t &days, unsigned &seconds) noexcept
+  {
+    std::int64_t const s = std::chrono::floor<std::chrono::seconds>(tp).time_since_epoch().count();
+
+    days = (s >= 0 ? s : s - 86399) / 86400;
+    seconds = static_cast<unsigned>(s - days * 86400);
+  }
+
+  /// @brief      Appends the date part of a time point as YYYY-MM-DD. (UTC)
+  /// @param[out] buffer: The buffer to append to.
+  /// @param[in]  tp: The time point.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-16/GGB - Function created.
+
+  void appendDateLiteral(std::string &buffer, timePoint_t tp)
+  {
+    char text[32];
+    std::int64_t days;
+    unsigned seconds;
+
+    splitTimePoint(tp, days, seconds);
+    buffer.append(text, writeDate(text, days));
+  }
+
+  /// @brief      Appends the date and time of a time point as YYYY-MM-DD HH:MM:SS. (UTC)
+  /// @param[out] buffer: The buffer to append to.
+  /// @param[in]  tp: The time point.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-16/GGB - Function created.
+
+  void appendDateTimeLiteral(std::string &buffer, timePoint_t tp)
+  {
+    char text[48];
+    std::int64_t days;
+    unsigned seconds;
+
+    splitTimePoint(tp, days, seconds);
+
+    char *output = writeDate(text, days);
+    *output++ = ' ';
+    buffer.append(text, writeTime(output, seconds));
+  }
+
+  /// @brief      Appends a quoted and escaped string literal. Runs of characters that do not need escaping are copied in one
+  ///             operation.
+  /// @param[out] buffer: The buffer to append to.
+  /// @param[in]  text: The text of the literal.
+  /// @param[in]  style: The quoting rules of the database.
+  /// @throws     std::bad_alloc
+  /// @note       SL_MYSQL assumes that NO_BACKSLASH_ESCAPES is not set. SL_POSTGRE is correct whatever the setting of
+  ///             standard_conforming_strings.
+  /// @version    2026-10-16/GGB - Function created.
+
+  void appendStringLiteral(std::string &buffer, std::string_view text, EStringLiteral style)
+  {
+    std::size_t const openQuote = buffer.size();
+    std::size_t index = 0;
+    bool prefixed = false;
+
+    buffer += '\'';
+
+    while (index < text.size())
+    {
+      std::size_t const special = findSpecial(text, index, style);
+
+      buffer.append(text.data() + index, special - index);
+      if (special < text.size())
+      {
+        char const c = text[special];
+
+        if (style == SL_MYSQL)
+        {
+          buffer += '\\';
+          switch (c)
+          {
+            case '\0': buffer += '0'; break;
+            case '\n': buffer += 'n'; break;
+            case '\r': buffer += 'r'; break;
+            case '\x1a': buffer += 'Z'; break;
+            default: buffer += c; break;
+          };
+        }
+        else
+        {
+          if ((c == '\\') && !prefixed)
+          {
+            buffer.insert(openQuote, 1, 'E');   // Only happens once per literal.
+            prefixed = true;
+          };
+          buffer += c;
+          buffer += c;
+        };
+      };
+      index = special + 1;
+    };
+
+    buffer += '\'';
+  }
+
+  /// @brief      Appends the time of day of a time point as HH:MM:SS. (UTC)
+  /// @param[out] buffer: The buffer to append to.
+  /// @param[in]  tp: The time point.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-16/GGB - Function created.
+
+  void appendTimeLiteral(std::string &buffer, timePoint_t tp)
+  {
+    char text[16];
+    std::int64_t days;
+    unsigned seconds;
+
+    splitTimePoint(tp, days, seconds);
+    buffer.append(text, writeTime(text, seconds));
+  }
+
+} // namespace GCL
@@ -0,0 +1,1193 @@
+﻿//*********************************************************************************************************************************
+//
+// PROJECT:             General Class Library
+// FILE:                sqlSerialiser.cpp
+// SUBSYSTEM:           Database library
+// LANGUAGE:            C++20
+// TARGET OS:           None - Standard C++
+// NAMESPACE:           GCL
+// AUTHOR:              Gavin Blakeman.
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the General Class Library (GCL)
+//
+//                      GCL is free software: you can redistribute it and/or modify it under the terms of the GNU General
+//                      Public License as published by the Free Software Foundation, either version 2 of the License, or
+//                      (at your option) any later version.
+//
+//                      GCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+//                      implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//                      for more details.
+//
+//                      You should have received a copy of the GNU General Public License along with GCL.  If not,
+//                      see <http://www.gnu.org/licenses/>.
+//
+// OVERVIEW:            Compact binary serialisation of a sqlWriter query.
+//
+// CLASSES INCLUDED:    sqlSerialiser
+//
+// HISTORY:             2026-10-16 GGB - File Created.
+//
+//*********************************************************************************************************************************
+
+#include "include/sqlSerialiser.h"
+
+  // Standard C++ library header files
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+  // Miscellaneous library header files
+
+#include "boost/locale.hpp"
+
+namespace GCL
+{
+  namespace
+  {
+    constexpr std::string_view MAGIC = "GSQW";
+
+      // Presence mask bits. The parts of a query are written in this order.
+
+    constexpr std::uint32_t F_SELECT = 1 << 0;
+    constexpr std::uint32_t F_RETURNING = 1 << 1;
+    constexpr std::uint32_t F_CONFLICT = 1 << 2;
+    constexpr std::uint32_t F_FROM = 1 << 3;
+    constexpr std::uint32_t F_INSERTTABLE = 1 << 4;
+    constexpr std::uint32_t F_INSERTVALUE = 1 << 5;
+    constexpr std::uint32_t F_GROUPBY = 1 << 6;
+    constexpr std::uint32_t F_ORDERBY = 1 << 7;
+    constexpr std::uint32_t F_JOIN = 1 << 8;
+    constexpr std::uint32_t F_OFFSET = 1 << 9;
+    constexpr std::uint32_t F_LIMIT = 1 << 10;
+    constexpr std::uint32_t F_SEEK = 1 << 11;
+    constexpr std::uint32_t F_COUNT = 1 << 12;
+    constexpr std::uint32_t F_MIN = 1 << 13;
+    constexpr std::uint32_t F_MAX = 1 << 14;
+    constexpr std::uint32_t F_UPDATETABLE = 1 << 15;
+    constexpr std::uint32_t F_SET = 1 << 16;
+    constexpr std::uint32_t F_DELETETABLE = 1 << 17;
+    constexpr std::uint32_t F_PROCEDURE = 1 << 18;
+    constexpr std::uint32_t F_PARAMETERS = 1 << 19;
+    constexpr std::uint32_t F_CURRENTTABLE = 1 << 20;
+    constexpr std::uint32_t F_WHERE = 1 << 21;
+
+      // Flags byte of the settings block.
+
+    constexpr std::uint8_t FL_DISTINCT = 1 << 0;
+    constexpr std::uint8_t FL_FORUPDATE = 1 << 1;
+    constexpr std::uint8_t FL_FORSHARE = 1 << 2;
+    constexpr std::uint8_t FL_PREPARED = 1 << 3;
+
+    using clockDuration_t = std::chrono::system_clock::duration;
+    using clockTimePoint_t = std::chrono::system_clock::time_point;
+  }
+
+  /// @brief  Appends the encoded values to a string.
+
+  class sqlSerialiser::writer
+  {
+  public:
+    explicit writer(std::string &b) : buffer(b) {}
+
+    void byte(std::uint8_t v) { buffer.push_back(static_cast<char>(v)); }
+
+    void varint(std::uint64_t v)
+    {
+      while (v >= 0x80)
+      {
+        byte(static_cast<std::uint8_t>(v | 0x80));
+        v >>= 7;
+      };
+      byte(static_cast<std::uint8_t>(v));
+    }
+
+    void zigzag(std::int64_t v) { varint((static_cast<std::uint64_t>(v) << 1) ^ static_cast<std::uint64_t>(v >> 63)); }
+
+    void text(std::string_view v)
+    {
+      varint(v.size());
+      buffer.append(v);
+    }
+
+    template<typename T>
+    void fixed(T v)
+    {
+      using bits_t = std::conditional_t<sizeof(T) == 4, std::uint32_t, std::uint64_t>;
+      bits_t bits = std::bit_cast<bits_t>(v);
+
+      for (std::size_t index = 0; index < sizeof(T); index++)
+      {
+        byte(static_cast<std::uint8_t>(bits));
+        bits >>= 8;
+      };
+    }
+
+      // Variant alternatives. The tag (variant index) is written by value().
+
+    void operator()(std::uint8_t p) { varint(p); }
+    void operator()(std::uint16_t p) { varint(p); }
+    void operator()(std::uint32_t p) { varint(p); }
+    void operator()(std::uint64_t p) { varint(p); }
+    void operator()(std::int8_t p) { zigzag(p); }
+    void operator()(std::int16_t p) { zigzag(p); }
+    void operator()(std::int32_t p) { zigzag(p); }
+    void operator()(std::int64_t p) { zigzag(p); }
+    void operator()(float p) { fixed(p); }
+    void operator()(double p) { fixed(p); }
+    void operator()(std::string const &p) { text(p); }
+    void operator()(date_t const &p) { zigzag(p.date().time_since_epoch().count()); }
+    void operator()(dateTime_t const &p) { zigzag(p.dateTime().time_since_epoch().count()); }
+    void operator()(time_t const &p) { zigzag(p.time().time_since_epoch().count()); }
+    void operator()(sqlWriter::bindValue_t const &p) { text(p.name()); }
+    void operator()(decimal_t const &p) { text(p.str()); }
+    void operator()(fixedDecimal_t const &p)
+    {
+      char digits[fixedDecimal_t::MAX_DIGITS + 260];
+      auto const [end, ec] = p.to_chars(digits, digits + sizeof(digits));
+
+      text(std::string_view(digits, static_cast<std::size_t>(end - digits)));
+    }
+
+    template<typename V>
+    void value(V const &v)
+    {
+      byte(static_cast<std::uint8_t>(v.index()));
+      std::visit(*this, v);
+    }
+
+      // Column-wise insert values are written as the equivalent parameter_t.
+
+    void cell(std::int64_t v) { value(sqlWriter::parameter_t(std::in_place_type<std::int64_t>, v)); }
+    void cell(double v) { value(sqlWriter::parameter_t(std::in_place_type<double>, v)); }
+    void cell(std::string_view v) { value(sqlWriter::parameter_t(std::in_place_type<std::string>, v)); }
+
+    void values(sqlWriter::parameterVector_t const &);
+    void strings(std::vector<std::string> const &);
+    void stringPairs(sqlWriter::stringPairStorage const &);
+    void insertValues(sqlWriter::valueType_t const &);
+    void parameterVariant(sqlWriter::parameterVariant_t const &);
+    void where(sqlWriter::whereVariant_t const &);
+    void query(sqlWriter const &);
+
+  private:
+    std::string &buffer;
+  };
+
+  /// @brief  Reads the encoded values from a buffer. Text is returned as views into the buffer.
+
+  class sqlSerialiser::reader
+  {
+  public:
+    explicit reader(std::string_view b) : buffer(b) {}
+
+    [[nodiscard]] bool atEnd() const noexcept { return position == buffer.size(); }
+
+    std::uint8_t byte()
+    {
+      need(1);
+      return static_cast<std::uint8_t>(buffer[position++]);
+    }
+
+    std::uint64_t varint()
+    {
+      std::uint64_t returnValue = 0;
+      std::uint8_t b = 0x80;
+
+      for (unsigned shift = 0; (b & 0x80) != 0; shift += 7)
+      {
+        RUNTIME_ASSERT(shift < 64, boost::locale::translate("sqlSerialiser: Invalid varint."));
+        b = byte();
+        returnValue |= static_cast<std::uint64_t>(b & 0x7F) << shift;
+      };
+
+      return returnValue;
+    }
+
+    std::int64_t zigzag()
+    {
+      std::uint64_t const v = varint();
+
+      return static_cast<std::int64_t>(v >> 1) ^ -static_cast<std::int64_t>(v & 1);
+    }
+
+    std::string_view text()
+    {
+      std::size_t const length = count(1);
+      std::string_view returnValue = buffer.substr(position, length);
+
+      position += length;
+      return returnValue;
+    }
+
+      /* Reads an element count. Every element is at least minimum bytes, so a count that cannot fit in the rest of the
+       * buffer is rejected before anything is reserved. */
+
+    std::size_t count(std::size_t minimum)
+    {
+      std::uint64_t const returnValue = varint();
+
+      RUNTIME_ASSERT(returnValue <= (buffer.size() - position) / std::max<std::size_t>(minimum, 1),
+                     boost::locale::translate("sqlSerialiser: Truncated buffer."));
+      return static_cast<std::size_t>(returnValue);
+    }
+
+    template<typename T>
+    T fixed()
+    {
+      using bits_t = std::conditional_t<sizeof(T) == 4, std::uint32_t, std::uint64_t>;
+      bits_t bits = 0;
+
+      for (std::size_t index = 0; index < sizeof(T); index++)
+      {
+        bits |= static_cast<bits_t>(byte()) << (8 * index);
+      };
+
+      return std::bit_cast<T>(bits);
+    }
+
+    template<typename E>
+    E enumeration(E last)
+    {
+      std::uint8_t const v = byte();
+
+      RUNTIME_ASSERT(v <= static_cast<std::uint8_t>(last), boost::locale::translate("sqlSerialiser: Invalid enumeration value."));
+      return static_cast<E>(v);
+    }
+
+      // Variant alternatives.
+
+    template<typename T> requires std::is_integral_v<T>
+    T read(std::type_identity<T>)
+    {
+      T returnValue;
+
+      if constexpr (std::is_signed_v<T>)
+      {
+        std::int64_t const v = zigzag();
+
+        RUNTIME_ASSERT(std::in_range<T>(v), boost::locale::translate("sqlSerialiser: Integer out of range."));
+        returnValue = static_cast<T>(v);
+      }
+      else
+      {
+        std::uint64_t const v = varint();
+
+        RUNTIME_ASSERT(std::in_range<T>(v), boost::locale::translate("sqlSerialiser: Integer out of range."));
+        returnValue = static_cast<T>(v);
+      };
+
+      return returnValue;
+    }
+    float read(std::type_identity<float>) { return fixed<float>(); }
+    double read(std::type_identity<double>) { return fixed<double>(); }
+    std::string read(std::type_identity<std::string>) { return std::string(text()); }
+    date_t read(std::type_identity<date_t>) { return date_t(clockTimePoint_t(clockDuration_t(zigzag()))); }
+    dateTime_t read(std::type_identity<dateTime_t>) { return dateTime_t(clockTimePoint_t(clockDuration_t(zigzag()))); }
+    time_t read(std::type_identity<time_t>) { return time_t(clockTimePoint_t(clockDuration_t(zigzag()))); }
+    sqlWriter::bindValue_t read(std::type_identity<sqlWriter::bindValue_t>) { return sqlWriter::bindValue_t(std::string(text())); }
+    decimal_t read(std::type_identity<decimal_t>) { return decimal_t(std::string(text())); }
+    fixedDecimal_t read(std::type_identity<fixedDecimal_t>) { return fixedDecimal_t(text()); }
+
+      /* Reads the tag and the alternative of a variant of values. */
+
+    template<typename V, std::size_t I = 0>
+    V alternative(std::size_t index)
+    {
+      if constexpr (I < std::variant_size_v<V>)
+      {
+        if (index == I)
+        {
+          return V(std::in_place_index<I>, read(std::type_identity<std::variant_alternative_t<I, V>>{}));
+        }
+        else
+        {
+          return alternative<V, I + 1>(index);
+        };
+      }
+      else
+      {
+        RUNTIME_ERROR(boost::locale::translate("sqlSerialiser: Invalid value tag."));
+      };
+    }
+
+    template<typename V>
+    V value() { return alternative<V>(byte()); }
+
+    sqlWriter::parameterVector_t values();
+    std::vector<std::string> strings();
+    sqlWriter::stringPairStorage stringPairs();
+    sqlWriter::pointer_t subQuery(sqlWriter const &, std::size_t);
+    sqlWriter::valueType_t insertValues(sqlWriter const &, std::size_t);
+    sqlWriter::parameterVariant_t parameterVariant(sqlWriter const &, std::size_t);
+    sqlWriter::whereVariant_t where(sqlWriter const &, std::size_t);
+    void query(sqlWriter &, std::size_t);
+
+  private:
+    std::string_view buffer;
+    std::size_t position = 0;
+
+    void need(std::size_t n) const
+    {
+      RUNTIME_ASSERT(n <= buffer.size() - position, boost::locale::translate("sqlSerialiser: Truncated buffer."));
+    }
+  };
+
+  //**********************************************************************************************************************
+  //
+  // writer
+  //
+  //**********************************************************************************************************************
+
+  /// @brief      Writes a row of values.
+  /// @param[in]  v: The values.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-16/GGB - Function created.
+
+  void sqlSerialiser::writer::values(sqlWriter::parameterVector_t const &v)
+  {
+    varint(v.size());
+    for (auto const &p : v)
+    {
+      value(p);
+    };
+  }
+
+  /// @brief      Writes a list of strings.
+  /// @param[in]  v: The strings.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-16/GGB - Function created.
+
+  void sqlSerialiser::writer::strings(std::vector<std::string> const &v)
+  {
+    varint(v.size());
+    for (auto const &s : v)
+    {
+      text(s);
+    };
+  }
+
+  /// @brief      Writes a list of string pairs. (min/max fields)
+  /// @param[in]  v: The pairs.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-16/GGB - Function created.
+
+  void sqlSerialiser::writer::stringPairs(sqlWriter::stringPairStorage const &v)
+  {
+    varint(v.size());
+    for (auto const &[first, second] : v)
+    {
+      text(first);
+      text(second);
+    };
+  }
+
+  /// @brief      Writes the insert values. Column-wise values are written as rows, as the spans cannot be restored.
+  /// @param[in]  v: The insert values.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-16/GGB - Function created.
+
+  void sqlSerialiser::writer::insertValues(sqlWriter::valueType_t const &v)
+  {
+    switch (v.index())
+    {
+      case 1:
+      {
+        auto const &rows = std::get<sqlWriter::valueStorage_t>(v);
+
+        byte(1);
+        varint(rows.size());
+        for (auto const &row : rows)
+        {
+          values(row);
+        };
+        break;
+      }
+      case 2:
+      {
+        byte(2);
+        query(*std::get<sqlWriter::pointer_t>(v));
+        break;
+      }
+      case 3:
+      {
+        auto const &columns = std::get<sqlWriter::columnStorage_t>(v);
+        std::size_t const rows = columns.empty() ? 0 : sqlWriter::columnLength(columns.front());
+
+        byte(1);
+        varint(rows);
+        for (std::size_t row = 0; row < rows; row++)
+        {
+          varint(columns.size());
+          for (auto const &column : columns)
+          {
+            std::visit([&](auto const &span) { cell(span[row]); }, column);
+          };
+        };
+        break;
+      }
+      default:
+      {
+        byte(0);
+        break;
+      }
+    };
+  }
+
+  /// @brief      Writes the value of a where test.
+  /// @param[in]  v: The value, list, set or sub-query.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-16/GGB - Function created.
+
+  void sqlSerialiser::writer::parameterVariant(sqlWriter::parameterVariant_t const &v)
+  {
+    byte(static_cast<std::uint8_t>(v.index()));
+    switch (v.index())
+    {
+      case 0:
+      {
+        value(std::get<sqlWriter::parameter_t>(v));
+        break;
+      }
+      case 1:
+      {
+        values(std::get<sqlWriter::parameterVector_t>(v));
+        break;
+      }
+      case 2:
+      {
+        auto const &set = std::get<sqlWriter::parameterSet_t>(v);
+
+        varint(set.size());
+        for (auto const &p : set)
+        {
+          value(p);
+        };
+        break;
+      }
+      case 3:
+      {
+        query(*std::get<sqlWriter::pointer_t>(v));
+        break;
+      }
+      default:
+      {
+        CODE_ERROR();
+      }
+    };
+  }
+
+  /// @brief      Writes a where clause tree.
+  /// @param[in]  v: The root of the (sub) tree.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-16/GGB - Function created.
+
+  void sqlSerialiser::writer::where(sqlWriter::whereVariant_t const &v)
+  {
+    byte(static_cast<std::uint8_t>(v.base.index()));
+    switch (v.base.index())
+    {
+      case 0:
+      {
+        break;
+      }
+      case 1:
+      {
+        auto const &[column, oper, parameter] = std::get<sqlWriter::whereTest_t>(v.base);
+
+        text(column);
+        byte(static_cast<std::uint8_t>(oper));
+        parameterVariant(parameter);
+        break;
+      }
+      case 2:
+      {
+        auto const &[lhs, oper, rhs] = std::get<sqlWriter::whereLogical_t>(v.base);
+
+        where(*lhs);
+        byte(static_cast<std::uint8_t>(oper));
+        where(*rhs);
+        break;
+      }
+      default:
+      {
+        CODE_ERROR();
+      }
+    };
+  }
+
+  /// @brief      Writes a query. Sub-queries are written recursively.
+  /// @param[in]  q: The query.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-16/GGB - Function created.
+
+  void sqlSerialiser::writer::query(sqlWriter const &q)
+  {
+    std::uint32_t mask = 0;
+    std::uint8_t flags = 0;
+
+    flags |= q.distinct_ ? FL_DISTINCT : 0;
+    flags |= q.forUpdate_ ? FL_FORUPDATE : 0;
+    flags |= q.forShare_ ? FL_FORSHARE : 0;
+    flags |= q.preparedStatement_ ? FL_PREPARED : 0;
+
+    mask |= q.selectFields.empty() ? 0 : F_SELECT;
+    mask |= q.returningFields_.empty() ? 0 : F_RETURNING;
+    mask |= q.conflictKeys_.empty() ? 0 : F_CONFLICT;
+    mask |= q.fromFields.empty() ? 0 : F_FROM;
+    mask |= q.insertTable.empty() ? 0 : F_INSERTTABLE;
+    mask |= (q.insertValue.index() == 0) ? 0 : F_INSERTVALUE;
+    mask |= q.groupByFields_.empty() ? 0 : F_GROUPBY;
+    mask |= q.orderByFields.empty() ? 0 : F_ORDERBY;
+    mask |= q.joinFields.empty() ? 0 : F_JOIN;
+    mask |= q.offsetValue ? F_OFFSET : 0;
+    mask |= q.limitValue ? F_LIMIT : 0;
+    mask |= q.seekKeys_.empty() ? 0 : F_SEEK;
+    mask |= q.countValue ? F_COUNT : 0;
+    mask |= q.minFields.empty() ? 0 : F_MIN;
+    mask |= q.maxFields.empty() ? 0 : F_MAX;
+    mask |= q.updateTable.empty() ? 0 : F_UPDATETABLE;
+    mask |= q.setFields.empty() ? 0 : F_SET;
+    mask |= q.deleteTable.empty() ? 0 : F_DELETETABLE;
+    mask |= q.procedureName_.empty() ? 0 : F_PROCEDURE;
+    mask |= q.procedureParameters_.empty() ? 0 : F_PARAMETERS;
+    mask |= q.currentTable.empty() ? 0 : F_CURRENTTABLE;
+    mask |= (q.whereClause_.base.index() == 0) ? 0 : F_WHERE;
+
+      // Settings block.
+
+    byte(static_cast<std::uint8_t>(q.dialect));
+    byte(static_cast<std::uint8_t>(q.inList_));
+    varint(q.inListThreshold_);
+    varint(q.inListChunk_);
+    varint(q.arena_ ? q.arenaSize_ : 0);
+    byte(static_cast<std::uint8_t>(q.queryType));
+    byte(flags);
+    varint(mask);
+
+    if (mask & F_SELECT)
+    {
+      varint(q.selectFields.size());
+      for (auto const &s : q.selectFields)
+      {
+        value(s);
+      };
+    };
+    if (mask & F_RETURNING)
+    {
+      strings(q.returningFields_);
+    };
+    if (mask & F_CONFLICT)
+    {
+      strings(q.conflictKeys_);
+    };
+    if (mask & F_FROM)
+    {
+      varint(q.fromFields.size());
+      for (auto const &[source, alias] : q.fromFields)
+      {
+        byte(static_cast<std::uint8_t>(source.index()));
+        if (source.index() == 0)
+        {
+          text(std::get<std::string>(source));
+        }
+        else
+        {
+          query(*std::get<sqlWriter::pointer_t>(source));
+        };
+        byte(alias ? 1 : 0);
+        if (alias)
+        {
+          text(*alias);
+        };
+      };
+    };
+    if (mask & F_INSERTTABLE)
+    {
+      text(q.insertTable);
+    };
+    if (mask & F_INSERTVALUE)
+    {
+      insertValues(q.insertValue);
+    };
+    if (mask & F_GROUPBY)
+    {
+      varint(q.groupByFields_.size());
+      for (auto const &g : q.groupByFields_)
+      {
+        byte(static_cast<std::uint8_t>(g.index()));
+        if (g.index() == 0)
+        {
+          varint(std::get<std::size_t>(g));
+        }
+        else
+        {
+          text(std::get<std::string>(g));
+        };
+      };
+    };
+    if (mask & F_ORDERBY)
+    {
+      varint(q.orderByFields.size());
+      for (auto const &[column, order] : q.orderByFields)
+      {
+        text(column);
+        byte(static_cast<std::uint8_t>(order));
+      };
+    };
+    if (mask & F_JOIN)
+    {
+      varint(q.joinFields.size());
+      for (auto const &[lhsField, rhsField, join, table, alias] : q.joinFields)
+      {
+        text(lhsField);
+        text(rhsField);
+        byte(static_cast<std::uint8_t>(join));
+        text(table.name());
+        text(table.alias());
+        text(alias);
+      };
+    };
+    if (mask & F_OFFSET)
+    {
+      varint(*q.offsetValue);
+    };
+    if (mask & F_LIMIT)
+    {
+      varint(*q.limitValue);
+    };
+    if (mask & F_SEEK)
+    {
+      values(q.seekKeys_);
+    };
+    if (mask & F_COUNT)
+    {
+      text(q.countValue->first);
+      text(q.countValue->second);
+    };
+    if (mask & F_MIN)
+    {
+      stringPairs(q.minFields);
+    };
+    if (mask & F_MAX)
+    {
+      stringPairs(q.maxFields);
+    };
+    if (mask & F_UPDATETABLE)
+    {
+      text(q.updateTable);
+    };
+    if (mask & F_SET)
+    {
+      varint(q.setFields.size());
+      for (auto const &[column, p] : q.setFields)
+      {
+        text(column);
+        value(p);
+      };
+    };
+    if (mask & F_DELETETABLE)
+    {
+      text(q.deleteTable);
+    };
+    if (mask & F_PROCEDURE)
+    {
+      text(q.procedureName_);
+    };
+    if (mask & F_PARAMETERS)
+    {
+      values(q.procedureParameters_);
+    };
+    if (mask & F_CURRENTTABLE)
+    {
+      text(q.currentTable);
+    };
+    if (mask & F_WHERE)
+    {
+      where(q.whereClause_);
+    };
+  }
+
+  //**********************************************************************************************************************
+  //
+  // reader
+  //
+  //**********************************************************************************************************************
+
+  /// @brief      Reads a row of values.
+  /// @returns    The values.
+  /// @throws     GCL::CRuntimeAssert
+  /// @version    2026-10-16/GGB - Function created.
+
+  sqlWriter::parameterVector_t sqlSerialiser::reader::values()
+  {
+    std::size_t const n = count(2);
+    sqlWriter::parameterVector_t returnValue;
+
+    returnValue.reserve(n);
+    for (std::size_t index = 0; index < n; index++)
+    {
+      returnValue.push_back(value<sqlWriter::parameter_t>());
+    };
+
+    return returnValue;
+  }
+
+  /// @brief      Reads a list of strings.
+  /// @returns    The strings.
+  /// @throws     GCL::CRuntimeAssert
+  /// @version    2026-10-16/GGB - Function created.
+
+  std::vector<std::string> sqlSerialiser::reader::strings()
+  {
+    std::size_t const n = count(1);
+    std::vector<std::string> returnValue;
+
+    returnValue.reserve(n);
+    for (std::size_t index = 0; index < n; index++)
+    {
+      returnValue.emplace_back(text());
+    };
+
+    return returnValue;
+  }
+
+  /// @brief      Reads a list of string pairs.
+  /// @returns    The pairs.
+  /// @throws     GCL::CRuntimeAssert
+  /// @version    2026-10-16/GGB - Function created.
+
+  sqlWriter::stringPairStorage sqlSerialiser::reader::stringPairs()
+  {
+    std::size_t const n = count(2);
+    sqlWriter::stringPairStorage returnValue;
+
+    returnValue.reserve(n);
+    for (std::size_t index = 0; index < n; index++)
+    {
+      std::string_view const first = text();
+      std::string_view const second = text();
+
+      returnValue.emplace_back(first, second);
+    };
+
+    return returnValue;
+  }
+
+  /// @brief      Reads a sub-query. The node is allocated from the arena of the owning query.
+  /// @param[in]  owner: The query that holds the sub-query.
+  /// @param[in]  depth: The nesting depth.
+  /// @returns    The sub-query.
+  /// @throws     GCL::CRuntimeAssert
+  /// @version    2026-10-16/GGB - Function created.
+
+  sqlWriter::pointer_t sqlSerialiser::reader::subQuery(sqlWriter const &owner, std::size_t depth)
+  {
+    sqlWriter q;
+
+    query(q, depth + 1);
+    return owner.makeNode<sqlWriter>(std::move(q));
+  }
+
+  /// @brief      Reads the insert values.
+  /// @param[in]  owner: The insert query.
+  /// @param[in]  depth: The nesting depth.
+  /// @returns    The insert values.
+  /// @throws     GCL::CRuntimeAssert
+  /// @version    2026-10-16/GGB - Function created.
+
+  sqlWriter::valueType_t sqlSerialiser::reader::insertValues(sqlWriter const &owner, std::size_t depth)
+  {
+    sqlWriter::valueType_t returnValue;
+
+    switch (byte())
+    {
+      case 0:
+      {
+        break;
+      }
+      case 1:
+      {
+        std::size_t const n = count(1);
+        sqlWriter::valueStorage_t rows;
+
+        rows.reserve(n);
+        for (std::size_t index = 0; index < n; index++)
+        {
+          rows.push_back(values());
+        };
+        returnValue = std::move(rows);
+        break;
+      }
+      case 2:
+      {
+        returnValue = subQuery(owner, depth);
+        break;
+      }
+      default:
+      {
+        RUNTIME_ERROR(boost::locale::translate("sqlSerialiser: Invalid value tag."));
+      }
+    };
+
+    return returnValue;
+  }
+
+  /// @brief      Reads the value of a where test.
+  /// @param[in]  owner: The query that holds the where clause.
+  /// @param[in]  depth: The nesting depth.
+  /// @returns    The value, list, set or sub-query.
+  /// @throws     GCL::CRuntimeAssert
+  /// @version    2026-10-16/GGB - Function created.
+
+  sqlWriter::parameterVariant_t sqlSerialiser::reader::parameterVariant(sqlWriter const &owner, std::size_t depth)
+  {
+    sqlWriter::parameterVariant_t returnValue;
+
+    switch (byte())
+    {
+      case 0:
+      {
+        returnValue = value<sqlWriter::parameter_t>();
+        break;
+      }
+      case 1:
+      {
+        returnValue = values();
+        break;
+      }
+      case 2:
+      {
+        std::size_t const n = count(2);
+        sqlWriter::parameterSet_t set;
+
+        for (std::size_t index = 0; index < n; index++)
+        {
+          set.insert(value<sqlWriter::parameter_t>());
+        };
+        returnValue = std::move(set);
+        break;
+      }
+      case 3:
+      {
+        returnValue = subQuery(owner, depth);
+        break;
+      }
+      default:
+      {
+        RUNTIME_ERROR(boost::locale::translate("sqlSerialiser: Invalid value tag."));
+      }
+    };
+
+    return returnValue;
+  }
+
+  /// @brief      Reads a where clause tree. The nodes are allocated from the arena of the owning query.
+  /// @param[in]  owner: The query that holds the where clause.
+  /// @param[in]  depth: The nesting depth.
+  /// @returns    The root of the (sub) tree.
+  /// @throws     GCL::CRuntimeAssert
+  /// @version    2026-10-16/GGB - Function created.
+
+  sqlWriter::whereVariant_t sqlSerialiser::reader::where(sqlWriter const &owner, std::size_t depth)
+  {
+    sqlWriter::whereVariant_t returnValue;
+
+    RUNTIME_ASSERT(depth < MAX_DEPTH, boost::locale::translate("sqlSerialiser: Query is nested too deeply."));
+
+    switch (byte())
+    {
+      case 0:
+      {
+        break;
+      }
+      case 1:
+      {
+        std::string_view const column = text();
+        operator_t const oper = enumeration(nin);
+        sqlWriter::parameterVariant_t parameter = parameterVariant(owner, depth);
+
+        returnValue = sqlWriter::whereVariant_t(std::string(column), oper, std::move(parameter));
+        break;
+      }
+      case 2:
+      {
+        sqlWriter::wherePointer_t lhs = owner.makeNode<sqlWriter::whereVariant_t>(where(owner, depth + 1));
+        logicalOperator_t const oper = enumeration(NOT);
+        sqlWriter::wherePointer_t rhs = owner.makeNode<sqlWriter::whereVariant_t>(where(owner, depth + 1));
+
+        returnValue = sqlWriter::whereVariant_t(sqlWriter::whereLogical_t(std::move(lhs), oper, std::move(rhs)));
+        break;
+      }
+      default:
+      {
+        RUNTIME_ERROR(boost::locale::translate("sqlSerialiser: Invalid where clause tag."));
+      }
+    };
+
+    return returnValue;
+  }
+
+  /// @brief      Reads a query. The arena (if any) is created before the nodes are read.
+  /// @param[out] q: The query to read into. This must be an empty query.
+  /// @param[in]  depth: The nesting depth.
+  /// @throws     GCL::CRuntimeAssert
+  /// @version    2026-10-16/GGB - Function created.
+
+  void sqlSerialiser::reader::query(sqlWriter &q, std::size_t depth)
+  {
+    RUNTIME_ASSERT(depth < MAX_DEPTH, boost::locale::translate("sqlSerialiser: Query is nested too deeply."));
+
+    q.dialect = enumeration(sqlWriter::POSTGRE);
+    q.inList_ = enumeration(sqlWriter::IN_TEMP_TABLE);
+    q.inListThreshold_ = varint();
+    q.inListChunk_ = varint();
+
+    std::size_t const arenaSize = varint();
+    if (arenaSize != 0)
+    {
+      q.useArena(arenaSize);
+    };
+
+    q.queryType = enumeration(sqlWriter::qt_call);
+
+    std::uint8_t const flags = byte();
+    q.distinct_ = (flags & FL_DISTINCT) != 0;
+    q.forUpdate_ = (flags & FL_FORUPDATE) != 0;
+    q.forShare_ = (flags & FL_FORSHARE) != 0;
+    q.preparedStatement_ = (flags & FL_PREPARED) != 0;
+
+    std::uint64_t const mask = varint();
+
+    if (mask & F_SELECT)
+    {
+      std::size_t const n = count(2);
+
+      q.selectFields.reserve(n);
+      for (std::size_t index = 0; index < n; index++)
+      {
+        q.selectFields.push_back(value<sqlWriter::selectExpression_t>());
+      };
+    };
+    if (mask & F_RETURNING)
+    {
+      q.returningFields_ = strings();
+    };
+    if (mask & F_CONFLICT)
+    {
+      q.conflictKeys_ = strings();
+    };
+    if (mask & F_FROM)
+    {
+      std::size_t const n = count(2);
+
+      q.fromFields.reserve(n);
+      for (std::size_t index = 0; index < n; index++)
+      {
+        sqlWriter::from_t source;
+        std::optional<std::string> alias;
+
+        if (byte() == 0)
+        {
+          source = std::string(text());
+        }
+        else
+        {
+          source = subQuery(q, depth);
+        };
+        if (byte() != 0)
+        {
+          alias = std::string(text());
+        };
+        q.fromFields.emplace_back(std::move(source), std::move(alias));
+      };
+    };
+    if (mask & F_INSERTTABLE)
+    {
+      q.insertTable = text();
+    };
+    if (mask & F_INSERTVALUE)
+    {
+      q.insertValue = insertValues(q, depth);
+    };
+    if (mask & F_GROUPBY)
+    {
+      std::size_t const n = count(2);
+
+      q.groupByFields_.reserve(n);
+      for (std::size_t index = 0; index < n; index++)
+      {
+        if (byte() == 0)
+        {
+          q.groupByFields_.emplace_back(std::in_place_index<0>, varint());
+        }
+        else
+        {
+          q.groupByFields_.emplace_back(std::in_place_index<1>, text());
+        };
+      };
+    };
+    if (mask & F_ORDERBY)
+    {
+      std::size_t const n = count(2);
+
+      q.orderByFields.reserve(n);
+      for (std::size_t index = 0; index < n; index++)
+      {
+        std::string_view const column = text();
+        EOrderBy const order = enumeration(DESC);
+
+        q.orderByFields.emplace_back(std::string(column), order);
+      };
+    };
+    if (mask & F_JOIN)
+    {
+      std::size_t const n = count(6);
+
+      q.joinFields.reserve(n);
+      for (std::size_t index = 0; index < n; index++)
+      {
+        std::string_view const lhsField = text();
+        std::string_view const rhsField = text();
+        EJoin const join = enumeration(JOIN_SELF);
+        std::string_view const table = text();
+        std::string_view const tableAlias = text();
+        std::string_view const alias = text();
+
+        q.joinFields.emplace_back(std::string(lhsField), std::string(rhsField), join,
+                                  sqlWriter::tableName_t(std::string(table), std::string(tableAlias)), std::string(alias));
+      };
+    };
+    if (mask & F_OFFSET)
+    {
+      q.offsetValue = varint();
+    };
+    if (mask & F_LIMIT)
+    {
+      q.limitValue = varint();
+    };
+    if (mask & F_SEEK)
+    {
+      q.seekKeys_ = values();
+    };
+    if (mask & F_COUNT)
+    {
+      std::string_view const column = text();
+      std::string_view const alias = text();
+
+      q.countValue = std::make_pair(std::string(column), std::string(alias));
+    };
+    if (mask & F_MIN)
+    {
+      q.minFields = stringPairs();
+    };
+    if (mask & F_MAX)
+    {
+      q.maxFields = stringPairs();
+    };
+    if (mask & F_UPDATETABLE)
+    {
+      q.updateTable = text();
+    };
+    if (mask & F_SET)
+    {
+      std::size_t const n = count(2);
+
+      q.setFields.reserve(n);
+      for (std::size_t index = 0; index < n; index++)
+      {
+        std::string_view const column = text();
+        sqlWriter::parameter_t p = value<sqlWriter::parameter_t>();
+
+        q.setFields.emplace_back(std::string(column), std::move(p));
+      };
+    };
+    if (mask & F_DELETETABLE)
+    {
+      q.deleteTable = text();
+    };
+    if (mask & F_PROCEDURE)
+    {
+      q.procedureName_ = text();
+    };
+    if (mask & F_PARAMETERS)
+    {
+      q.procedureParameters_ = values();
+    };
+    if (mask & F_CURRENTTABLE)
+    {
+      q.currentTable = text();
+    };
+    if (mask & F_WHERE)
+    {
+      q.whereClause_ = where(q, depth);
+    };
+  }
+
+  //**********************************************************************************************************************
+  //
+  // sqlSerialiser
+  //
+  //**********************************************************************************************************************
+
+  /// @brief      Appends the serialised query to a buffer.
+  /// @param[out] buffer: The buffer to append to.
+  /// @param[in]  q: The query to serialise.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-16/GGB - Function created.
+
+  void sqlSerialiser::serialise(std::string &buffer, sqlWriter const &q)
+  {
+    writer w(buffer);
+
+    buffer.append(MAGIC);
+    w.byte(VERSION);
+    w.query(q);
+  }
+
+  /// @brief      Serialises a query. See serialise(std::string &, sqlWriter const &)
+  /// @param[in]  q: The query to serialise.
+  /// @returns    The serialised query.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-16/GGB - Function created.
+
+  std::string sqlSerialiser::serialise(sqlWriter const &q)
+  {
+    std::string returnValue;
+
+    serialise(returnValue, q);
+    return returnValue;
+  }
+
+  /// @brief      Restores a query from a serialised buffer. The buffer is only read while the function runs.
+  /// @param[in]  buffer: The serialised query.
+  /// @returns    The query.
+  /// @throws     GCL::CRuntimeAssert (Invalid or truncated buffer.)
+  /// @version    2026-10-16/GGB - Function created.
+
+  sqlWriter sqlSerialiser::deserialise(std::string_view buffer)
+  {
+    sqlWriter returnValue;
+    reader r(buffer);
+
+    RUNTIME_ASSERT(buffer.substr(0, MAGIC.size()) == MAGIC, boost::locale::translate("sqlSerialiser: Not a serialised query."));
+    for (std::size_t index = 0; index < MAGIC.size(); index++)
+    {
+      r.byte();
+    };
+    RUNTIME_ASSERT(r.byte() == VERSION, boost::locale::translate("sqlSerialiser: Unsupported version."));
+
+    r.query(returnValue, 0);
+
+    RUNTIME_ASSERT(r.atEnd(), boost::locale::translate("sqlSerialiser: Trailing data after the query."));
+
+    return returnValue;
+  }
+
+} // namespace GCL
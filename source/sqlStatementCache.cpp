@@ -0,0 +1,169 @@
+//*********************************************************************************************************************************
+//
+// PROJECT:             General Class Library
+// FILE:                sqlStatementCache.cpp
+// SUBSYSTEM:           Database library
+// LANGUAGE:            C++20
+// TARGET OS:           None - Standard C++
+// NAMESPACE:           GCL
+// AUTHOR:              Gavin Blakeman.
+// LICENSE:             GPLv2
+//
+//                      Copyright 2026 Gavin Blakeman.
+//                      This file is part of the General Class Library (GCL)
+//
+//                      GCL is free software: you can redistribute it and/or modify it under the terms of the GNU General
+//                      Public License as published by the Free Software Foundation, either version 2 of the License, or
+//                      (at your option) any later version.
+//
+//                      GCL is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the
+//                      implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//                      for more details.
+//
+//                      You should have received a copy of the GNU General Public License along with GCL.  If not,
+//                      see <http://www.gnu.org/licenses/>.
+//
+// OVERVIEW:            A bounded, thread-safe, least recently used cache of rendered SQL statements. The cache is keyed by the
+//                      structural (shape) hash of a sqlWriter query.
+//
+// CLASSES INCLUDED:    sqlStatementCache
+//
+// HISTORY:             2026-10-16 GGB - File Created.
+//
+//*********************************************************************************************************************************
+
+#include "include/sqlStatementCache.h"
+
+namespace GCL
+{
+  /// @brief      Constructor for the class.
+  /// @param[in]  c: The maximum number of statements to cache. A capacity of zero disables the cache.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
+
+  sqlStatementCache::sqlStatementCache(std::size_t c) : capacity_(c)
+  {
+  }
+
+  /// @brief      Sets the capacity of the cache. If the new capacity is less than the number of cached statements, the least
+  ///             recently used statements are evicted.
+  /// @param[in]  c: The new capacity. Zero disables the cache.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
+
+  void sqlStatementCache::capacity(std::size_t c)
+  {
+    std::lock_guard<std::mutex> lg{cacheMutex};
+
+    capacity_.store(c, std::memory_order_relaxed);
+    trim();
+  }
+
+  /// @brief      Removes all the statements from the cache. The statistics are not reset.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
+
+  void sqlStatementCache::clear()
+  {
+    std::lock_guard<std::mutex> lg{cacheMutex};
+
+    cacheIndex.clear();
+    lruList.clear();
+  }
+
+  /// @brief      Inserts a rendered statement into the cache.
+  /// @param[in]  key: The shape key of the statement.
+  /// @param[in]  text: The rendered statement.
+  /// @throws     std::bad_alloc
+  /// @note       If two threads render the same shape concurrently, the second insert only refreshes the entry.
+  /// @version    2026-10-16/GGB - Function created.
+
+  void sqlStatementCache::insert(key_t key, std::string_view text)
+  {
+    std::lock_guard<std::mutex> lg{cacheMutex};
+
+    if (capacity_.load(std::memory_order_relaxed) != 0)
+    {
+      if (auto iter = cacheIndex.find(key); iter != cacheIndex.end())
+      {
+        lruList.splice(lruList.begin(), lruList, iter->second);
+      }
+      else
+      {
+        lruList.emplace_front(key, std::string(text));
+        cacheIndex.emplace(key, lruList.begin());
+        trim();
+      };
+    };
+  }
+
+  /// @brief      Searches the cache for a statement. If found, the statement is appended to the buffer.
+  /// @param[in]  key: The shape key of the statement.
+  /// @param[out] buffer: The buffer to append the statement to.
+  /// @returns    true if the statement was found.
+  /// @throws     std::bad_alloc
+  /// @version    2026-10-16/GGB - Function created.
+
+  bool sqlStatementCache::lookup(key_t key, std::string &buffer)
+  {
+    bool returnValue = false;
+    std::lock_guard<std::mutex> lg{cacheMutex};
+
+    if (auto iter = cacheIndex.find(key); iter != cacheIndex.end())
+    {
+      lruList.splice(lruList.begin(), lruList, iter->second);
+      buffer += iter->second->second;
+      hits_.fetch_add(1, std::memory_order_relaxed);
+      returnValue = true;
+    }
+    else
+    {
+      misses_.fetch_add(1, std::memory_order_relaxed);
+    };
+
+    return returnValue;
+  }
+
+  /// @brief      Resets the hit, miss and eviction counters.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
+
+  void sqlStatementCache::resetStatistics() noexcept
+  {
+    hits_.store(0, std::memory_order_relaxed);
+    misses_.store(0, std::memory_order_relaxed);
+    evictions_.store(0, std::memory_order_relaxed);
+  }
+
+  /// @brief      Returns the cache statistics. These can be used to size the cache.
+  /// @returns    The statistics.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
+
+  sqlStatementCache::statistics_t sqlStatementCache::statistics() const
+  {
+    std::lock_guard<std::mutex> lg{cacheMutex};
+
+    return { hits_.load(std::memory_order_relaxed),
+             misses_.load(std::memory_order_relaxed),
+             evictions_.load(std::memory_order_relaxed),
+             cacheIndex.size(),
+             capacity_.load(std::memory_order_relaxed) };
+  }
+
+  /// @brief      Evicts the least recently used statements until the cache is within its capacity.
+  /// @pre        cacheMutex must be held.
+  /// @throws     None.
+  /// @version    2026-10-16/GGB - Function created.
+
+  void sqlStatementCache::trim()
+  {
+    while (cacheIndex.size() > capacity_.load(std::memory_order_relaxed))
+    {
+      cacheIndex.erase(lruList.back().first);
+      lruList.pop_back();
+      evictions_.fetch_add(1, std::memory_order_relaxed);
+    };
+  }
+
+} // namespace GCL
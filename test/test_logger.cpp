@@ -0,0 +1,371 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#define TEST  // Used to exclude error reporting and avoid having to link GCL + others.
+
+#include <chrono>
+#include <filesystem>
+#include <future>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "include/logger/filters/debugFilter.h"
+#include "include/logger/queues/lockFreeQueue.h"
+#include "include/logger/queues/ringQueue.h"
+#include "include/logger/records/debugRecord.h"
+#include "include/logger/records/formatRecord.h"
+#include "include/logger/records/recordPool.h"
+#include "include/logger/sinks/fileSink.h"
+#include "include/logger/sinks/streamSink.h"
+
+namespace
+{
+  /// @brief      Takes all the records from a queue and returns their text.
+
+  std::string takeText(GCL::logger::CBaseQueue &queue)
+  {
+    GCL::logger::recordBatch_t batch;
+    std::string returnValue;
+
+    queue.take(batch, 100);
+    for (auto const &record : batch)
+    {
+      returnValue += record->text();
+    };
+
+    return returnValue;
+  }
+
+  /// @brief      Stream buffer that counts the flushes of the stream.
+
+  class CCountingBuffer : public std::stringbuf
+  {
+  public:
+    int flushes = 0;
+
+  protected:
+    virtual int sync() override
+    {
+      flushes++;
+      return std::stringbuf::sync();
+    }
+  };
+
+  /// @brief      Returns a batch with one debug record.
+
+  GCL::logger::recordBatch_t makeBatch(GCL::logger::CDebugRecord::severity_t severity, std::string_view text)
+  {
+    GCL::logger::recordBatch_t returnValue;
+
+    returnValue.push_back(std::make_unique<GCL::logger::CDebugRecord>(severity, text));
+
+    return returnValue;
+  }
+}
+
+BOOST_AUTO_TEST_SUITE(logger_test)
+
+BOOST_AUTO_TEST_CASE(lockFreeQueue)
+{
+  using namespace GCL::logger;
+  CLockFreeQueue queue;
+  recordBatch_t batch;
+
+  BOOST_TEST(queue.empty());
+
+  queue.push(std::make_unique<CBaseRecord>("A"));
+  queue.push(std::make_unique<CBaseRecord>("B"));
+  queue.push(std::make_unique<CBaseRecord>("C"));
+  BOOST_TEST(!queue.empty());
+  BOOST_TEST(queue.front().text() == "A");
+  queue.pop();
+  BOOST_TEST(queue.take(batch, 1) == 1);
+  BOOST_TEST(batch.back()->text() == "B");
+  queue.push(std::make_unique<CBaseRecord>("D"));     // Pushed after the writer reached the head.
+  BOOST_TEST(queue.take(batch, 10) == 2);
+  BOOST_REQUIRE(batch.size() == 3);
+  BOOST_TEST(batch[1]->text() == "C");
+  BOOST_TEST(batch[2]->text() == "D");
+  BOOST_TEST(queue.empty());
+
+    // Several producers. Each producer's records must arrive in order, and none may be lost.
+
+  constexpr std::uint32_t PRODUCERS = 4;
+  constexpr std::size_t RECORDS = 5000;
+  std::vector<std::thread> producers;
+  std::vector<std::size_t> next(PRODUCERS, 0);
+  std::size_t received = 0;
+  bool ordered = true;
+
+  for (std::uint32_t producer = 0; producer < PRODUCERS; producer++)
+  {
+    producers.emplace_back([&queue, producer]()
+    {
+      for (std::size_t index = 0; index < RECORDS; index++)
+      {
+        queue.push(std::make_unique<CDebugRecord>(producer, std::to_string(index)));
+      };
+    });
+  };
+
+  while (received < PRODUCERS * RECORDS)
+  {
+    batch.clear();
+    if (queue.take(batch, 64) == 0)
+    {
+      std::this_thread::yield();
+    };
+
+    for (auto const &record : batch)
+    {
+      CDebugRecord const &debugRecord = dynamic_cast<CDebugRecord const &>(*record);
+
+      ordered = ordered && (debugRecord.text() == std::to_string(next[debugRecord.severity()]));
+      next[debugRecord.severity()]++;
+      received++;
+    };
+  };
+
+  for (auto &producer : producers)
+  {
+    producer.join();
+  };
+
+  BOOST_TEST(ordered);
+  BOOST_TEST(received == PRODUCERS * RECORDS);
+  BOOST_TEST(queue.empty());
+}
+
+BOOST_AUTO_TEST_CASE(ringQueue_drop)
+{
+  using namespace GCL::logger;
+  CRingQueue newest(2, CRingQueue::dropNewest);
+  CRingQueue oldest(2, CRingQueue::dropOldest);
+  CRingQueue severity(2, CRingQueue::severityMask_t{0});
+
+  BOOST_TEST(newest.capacity() == 2);
+  BOOST_TEST(severity.policy() == CRingQueue::dropSeverity);
+
+  for (auto const *text : {"A", "B", "C"})
+  {
+    newest.push(std::make_unique<CBaseRecord>(text));
+    oldest.push(std::make_unique<CBaseRecord>(text));
+  };
+  BOOST_TEST(newest.dropped() == 1);
+  BOOST_TEST(takeText(newest) == "AB");
+  BOOST_TEST(oldest.dropped() == 1);
+  BOOST_TEST(oldest.front().text() == "B");     // The writer holds the front record. The record after it is dropped.
+  oldest.push(std::make_unique<CBaseRecord>("D"));
+  BOOST_TEST(oldest.dropped() == 2);
+  BOOST_TEST(takeText(oldest) == "BD");
+
+  severity.push(std::make_unique<CDebugRecord>(1, "a"));
+  severity.push(std::make_unique<CDebugRecord>(0, "b"));
+  severity.push(std::make_unique<CDebugRecord>(1, "c"));      // Not kept. Dropped.
+  severity.push(std::make_unique<CDebugRecord>(0, "d"));      // Kept. Replaces "a".
+  BOOST_TEST(severity.dropped() == 2);
+  BOOST_TEST(takeText(severity) == "bd");
+  BOOST_TEST(severity.blocked() == 0);
+}
+
+BOOST_AUTO_TEST_CASE(ringQueue_block)
+{
+  using namespace GCL::logger;
+  CRingQueue queue(1);
+
+  queue.push(std::make_unique<CBaseRecord>("A"));
+
+  std::thread producer([&queue]() { queue.push(std::make_unique<CBaseRecord>("B")); });
+
+  while (queue.blocked() == 0)
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  };
+  BOOST_TEST(takeText(queue) == "A");
+  producer.join();
+
+  BOOST_TEST(takeText(queue) == "B");
+  BOOST_TEST(queue.blocked() == 1);
+  BOOST_TEST(queue.dropped() == 0);
+}
+
+BOOST_AUTO_TEST_CASE(sinkFlushPolicy)
+{
+  using namespace GCL::logger;
+  using namespace std::chrono_literals;
+  CCountingBuffer buffer;
+  std::ostream stream(&buffer);
+  CStreamSink sink(std::make_shared<CBaseFilter>(), stream);
+
+  sink.writeRecords(makeBatch(3, "a"));                 // flushBatch is the default.
+  BOOST_TEST(buffer.flushes == 1);
+  BOOST_TEST(!sink.flushDue());
+
+  sink.flushPolicy(CBaseSink::flushSeverity, 1h, {0});
+  sink.writeRecords(makeBatch(3, "b"));
+  BOOST_TEST(buffer.flushes == 1);
+  BOOST_TEST(sink.flushDue().has_value());
+  sink.writeRecords(makeBatch(0, "c"));
+  BOOST_TEST(buffer.flushes == 2);
+  BOOST_TEST(!sink.flushDue());
+
+  sink.flushPolicy(CBaseSink::flushInterval, 10ms);
+  sink.writeRecords(makeBatch(0, "d"));
+  BOOST_TEST(buffer.flushes == 2);
+  BOOST_REQUIRE(sink.flushDue().has_value());
+
+  CBaseSink::clock_type::time_point const due = *sink.flushDue();
+
+  sink.flushIfDue(due - 1ms);
+  BOOST_TEST(buffer.flushes == 2);
+  sink.flushIfDue(due);
+  BOOST_TEST(buffer.flushes == 3);
+  BOOST_TEST(!sink.flushDue());
+
+  BOOST_TEST(buffer.str() == "a\nb\nc\nd\n");
+}
+
+BOOST_AUTO_TEST_CASE(sinkFilter)
+{
+  using namespace GCL::logger;
+  std::ostringstream stream;
+  CStreamSink sink(std::make_shared<CDebugFilter>(CDebugFilter::criticalityMap_t{ {0, "INFO"}, {1, "DEBUG"} },
+                                                  CDebugFilter::criticalityMask_t{0}), stream);
+  recordBatch_t batch;
+
+  batch.push_back(std::make_unique<CDebugRecord>(1, "hidden"));
+  batch.push_back(std::make_unique<CDebugRecord>(0, "shown"));
+  batch.push_back(makeFormatRecord(0, "formatted {}", 3));
+  sink.writeRecords(batch);
+
+  std::string const text = stream.str();
+
+  BOOST_TEST(text.find("hidden") == std::string::npos);
+  BOOST_TEST(text.find(" [INFO] shown\n") != std::string::npos);
+  BOOST_TEST(text.ends_with(" [INFO] formatted 3\n"));
+}
+
+BOOST_AUTO_TEST_CASE(fileSinkRotation)
+{
+  using namespace GCL::logger;
+  std::filesystem::path const directory = std::filesystem::temp_directory_path() / "gcl_test_fileSinkRotation";
+  std::uintmax_t total = 0;
+
+  std::filesystem::remove_all(directory);
+  std::filesystem::create_directories(directory);
+
+  {
+    CFileSink sink(std::make_shared<CBaseFilter>(), directory, "rotate", ".log");
+    recordBatch_t batch;
+
+    sink.setRotationPolicySize(4, 10);
+    for (auto const *text : {"aaaa", "bbbb", "cccc", "dddd", "eeee"})
+    {
+      batch.push_back(std::make_unique<CBaseRecord>(text));
+    };
+    sink.writeRecords(batch);
+  }
+
+    // The file is rotated before the record that would take it over the limit, so no file is larger than the limit.
+
+  for (auto const &entry : std::filesystem::directory_iterator(directory))
+  {
+    BOOST_TEST(entry.file_size() <= 10);
+    total += entry.file_size();
+  };
+  BOOST_TEST(total == 25);
+
+  std::filesystem::remove_all(directory);
+}
+
+BOOST_AUTO_TEST_CASE(formatRecord)
+{
+  using namespace GCL::logger;
+  CFormatRecord<int, double> record(2, "{} of {:.2f}", 3, 1.5);
+
+  BOOST_TEST(record.text() == "3 of 1.50");
+  BOOST_TEST(record.severity() == 2);
+
+  std::string text = "before";
+  std::string_view view = text;
+  std::unique_ptr<CBaseRecord> copied = makeFormatRecord(4, "{}|{}|{}", view, text.c_str(), 7u);
+
+  text = "after!";                                    // The arguments were copied when the record was created.
+  BOOST_TEST(copied->text() == "before|before|7");
+  BOOST_TEST(dynamic_cast<CDebugRecord const &>(*copied).severity() == 4);
+
+    // Strings share the inline buffer of the record. A string that does not fit is copied to the heap.
+
+  std::string const longText(CDebugRecord::INLINE_TEXT_SIZE - 1, 'x');
+  std::string appended;
+
+  copied = makeFormatRecord(0, "{}{}{}", text, longText, std::string_view("ab"));
+  text.clear();
+  BOOST_TEST(copied->text() == "after!" + longText + "ab");
+  copied->appendText(appended);
+  BOOST_TEST(appended == "after!" + longText + "ab");
+
+    // Records with string arguments fit in a pool block.
+
+  BOOST_TEST(sizeof(CFormatRecord<CFormatString, CFormatString, CFormatString>) <=
+             CRecordPool::BLOCK_SIZE - alignof(std::max_align_t));
+}
+
+BOOST_AUTO_TEST_CASE(recordPool)
+{
+  using namespace GCL::logger;
+  constexpr std::size_t RECORDS = 4 * CRecordPool::SLAB_BLOCKS;
+  std::vector<std::unique_ptr<CBaseRecord>> records;
+  std::promise<void> created;
+  std::promise<void> returned;
+  std::size_t slabs = 0;
+  bool reused = false;
+
+  auto const create = [&records]()
+  {
+    for (std::size_t index = 0; index < RECORDS; index++)
+    {
+      records.push_back(std::make_unique<CDebugRecord>(0, "pooled"));
+    };
+  };
+
+    // Blocks destroyed by another thread are returned to the pool of the thread that created them.
+
+  std::thread owner([&]()
+  {
+    create();
+    created.set_value();
+    returned.get_future().wait();
+    slabs = CRecordPool::slabs();
+    create();
+    reused = (CRecordPool::slabs() == slabs);
+  });
+
+  created.get_future().wait();
+  records.clear();
+  CRecordPool::flushReturns();
+  returned.set_value();
+  owner.join();
+  BOOST_TEST(reused);
+
+    // Blocks destroyed after the thread has ended are returned to its pool, which is adopted by the next thread.
+
+  BOOST_TEST(records.back()->text() == "pooled");
+  records.clear();
+  CRecordPool::flushReturns();
+  slabs = CRecordPool::slabs();
+
+  std::thread adopter([&]()
+  {
+    create();
+    reused = (CRecordPool::slabs() == slabs);
+    records.clear();
+  });
+  adopter.join();
+  BOOST_TEST(reused);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -6,6 +6,12 @@
 #include <vector>
 
 #include "include/SQLWriter.h"
+#include "include/sqlBatch.h"
+#include "include/sqlStaticStatement.h"
+#include "include/sqlBindBuffer.h"
+#include "include/sqlCompiledStatement.h"
+#include "include/sqlLiteral.h"
+#include "include/sqlSerialiser.h"
 
 BOOST_AUTO_TEST_SUITE(sqlWriter_test)
 
@@ -317,4 +323,799 @@ BOOST_AUTO_TEST_CASE(select_table_as)
   BOOST_TEST(sqlQuery.string() == "SELECT * FROM table AS t");
 }
 
+BOOST_AUTO_TEST_CASE(appendTo_buffer)
+{
+  using namespace GCL;
+  sqlWriter sqlQuery1, sqlQuery2, subQuery;
+  std::string buffer;
+
+  sqlQuery1.select({"*"}).from("table");
+  sqlQuery1.appendTo(buffer);
+  BOOST_TEST(buffer == "SELECT * FROM table");
+
+  buffer += "; ";
+  sqlQuery1.appendTo(buffer);
+  BOOST_TEST(buffer == "SELECT * FROM table; SELECT * FROM table");
+
+  buffer.clear();
+  subQuery.select({"ID"}).from("TBL2").where("COL1", eq, 3);
+  sqlQuery2.select({"ID"}).from("TBL1").where(where_v("ID", in, std::move(subQuery)));
+  sqlQuery2.appendTo(buffer);
+  BOOST_TEST(buffer == "SELECT ID FROM TBL1 WHERE (ID IN (SELECT ID FROM TBL2 WHERE (COL1 = 3)))");
+  BOOST_TEST(buffer == sqlQuery2.string());
+}
+
+BOOST_AUTO_TEST_CASE(statementCache)
+{
+  using namespace GCL;
+  sqlWriter sqlQuery1, sqlQuery2, sqlQuery3;
+
+  sqlWriter::statementCache().capacity(2);
+  sqlWriter::statementCache().resetStatistics();
+
+  sqlQuery1.preparedStatement(true).select({"ID"}).from("TBL").where("COL1", eq, "STR1");
+  sqlQuery2.preparedStatement(true).select({"ID"}).from("TBL").where("COL1", eq, "STR2");
+  sqlQuery3.preparedStatement(true).select({"ID"}).from("TBL").where("COL1", eq, 3);
+
+  BOOST_TEST(sqlQuery1.shapeKey() == sqlQuery2.shapeKey());
+  BOOST_TEST(sqlQuery1.shapeKey() != sqlQuery3.shapeKey());
+
+  BOOST_TEST(sqlQuery1.string() == "SELECT ID FROM TBL WHERE (COL1 = ?)");
+  BOOST_TEST(sqlQuery2.string() == "SELECT ID FROM TBL WHERE (COL1 = ?)");
+  BOOST_TEST(sqlQuery3.string() == "SELECT ID FROM TBL WHERE (COL1 = 3)");
+
+  sqlStatementCache::statistics_t statistics = sqlWriter::statementCache().statistics();
+  BOOST_TEST(statistics.hits == 1);
+  BOOST_TEST(statistics.misses == 2);
+  BOOST_TEST(statistics.size == 2);
+
+  sqlWriter::statementCache().capacity(0);
+  BOOST_TEST(sqlWriter::statementCache().statistics().evictions == 2);
+}
+
+namespace
+{
+  /// @brief  true if bindRow() accepts a value of type T.
+
+  template<typename T>
+  concept bindRowAccepts = requires(GCL::sqlCompiledStatement &statement, T &&value)
+  {
+    statement.bindRow(std::forward<T>(value));
+  };
+
+    // Slots refer to strings and decimals. Temporaries would dangle, so they are rejected.
+
+  static_assert(bindRowAccepts<std::string const &>);
+  static_assert(bindRowAccepts<std::string &>);
+  static_assert(!bindRowAccepts<std::string>);
+  static_assert(bindRowAccepts<GCL::decimal_t const &>);
+  static_assert(!bindRowAccepts<GCL::decimal_t>);
+  static_assert(bindRowAccepts<GCL::fixedDecimal_t>);
+  static_assert(bindRowAccepts<std::int64_t>);
+}
+
+BOOST_AUTO_TEST_CASE(compile)
+{
+  using namespace GCL;
+  sqlWriter sqlQuery1, sqlQuery2;
+
+  sqlQuery1.preparedStatement(true)
+           .select({"ID"})
+           .from("TBL")
+           .where(where_v(where_v("COL1", eq, "STR1"), AND, where_v("COL2", eq, sqlWriter::bindValue_t("ID"))));
+
+  sqlCompiledStatement statement1 = sqlQuery1.compile();
+  BOOST_TEST(statement1.sql() == "SELECT ID FROM TBL WHERE  ((COL1 = ?) AND (COL2 = :ID))");
+  BOOST_REQUIRE(statement1.slotCount() == 2);
+  BOOST_TEST(statement1.slotType(0) == sqlWriter::PT_STRING);
+  BOOST_TEST(statement1.slotType(1) == sqlWriter::PT_NONE);
+  BOOST_TEST(!statement1.isBound());
+
+  std::string value1 = "VALUE1";
+  statement1.bindRow(value1, std::int64_t(42));
+  BOOST_TEST(statement1.isBound());
+  BOOST_TEST(std::get<std::string_view>(statement1.slot(0)) == "VALUE1");
+  BOOST_TEST(std::get<std::int64_t>(statement1.slot(1)) == 42);
+  BOOST_CHECK_THROW(statement1.bind(0, std::int32_t(1)), GCL::runtime_error);
+  BOOST_CHECK_THROW(statement1.bindRow(value1), GCL::CRuntimeAssert);
+
+  sqlQuery2.preparedStatement(true).update("TBL").set({{"COL1", std::int32_t(1)}, {"COL2", "A"}}).where("ID", eq, "X");
+
+  sqlCompiledStatement statement2 = sqlQuery2.compile();
+  BOOST_TEST(statement2.sql() == "UPDATE TBL SET COL1 = ?, COL2 = ? WHERE (ID = ?)");
+  BOOST_REQUIRE(statement2.slotCount() == 3);
+  BOOST_TEST(statement2.slotType(0) == sqlWriter::PT_I32);
+  BOOST_TEST(statement2.slotType(1) == sqlWriter::PT_STRING);
+  BOOST_TEST(statement2.slotType(2) == sqlWriter::PT_STRING);
+}
+
+BOOST_AUTO_TEST_CASE(bindBuffer)
+{
+  using namespace GCL;
+  sqlWriter sqlQuery;
+  sqlBindBuffer mysqlBuffer(sqlWriter::MYSQL);
+  sqlBindBuffer postgreBuffer(sqlWriter::POSTGRE);
+
+  sqlQuery.preparedStatement(true)
+          .insertInto("TBL", {"COL1", "COL2"})
+          .values({ {std::int32_t(1), "ONE"}, {std::int32_t(-2), "TWO"} });
+
+  sqlQuery.bindValues(mysqlBuffer);
+  BOOST_REQUIRE(mysqlBuffer.size() == 4);
+  BOOST_TEST(mysqlBuffer.type(0) == sqlWriter::PT_I32);
+  BOOST_TEST(mysqlBuffer.format(0) == sqlBindBuffer::FMT_BINARY);
+  BOOST_TEST(mysqlBuffer.length(0) == 4);
+  BOOST_TEST(*static_cast<std::int32_t const *>(mysqlBuffer.buffer(2)) == -2);
+  BOOST_TEST(mysqlBuffer.type(3) == sqlWriter::PT_STRING);
+  BOOST_TEST(mysqlBuffer.text(3) == "TWO");
+  BOOST_TEST(std::string(static_cast<char const *>(mysqlBuffer.buffer(1))) == "ONE");
+
+  sqlQuery.bindValues(postgreBuffer);
+  BOOST_REQUIRE(postgreBuffer.size() == 4);
+  BOOST_TEST(std::string(postgreBuffer.paramValues()[2]) == "-2");
+  BOOST_TEST(postgreBuffer.paramLengths()[3] == 3);
+  BOOST_TEST(postgreBuffer.paramFormats()[0] == sqlBindBuffer::FMT_TEXT);
+
+  postgreBuffer.clear();
+  BOOST_TEST(postgreBuffer.empty());
+}
+
+BOOST_AUTO_TEST_CASE(insertStream)
+{
+  using namespace GCL;
+  sqlWriter sqlQuery;
+  std::vector<std::string> statements;
+  std::vector<std::size_t> counts;
+  std::int32_t rowNumber = 0;
+
+  auto const sink = [&](std::string_view text, std::size_t rows)
+  {
+    statements.emplace_back(text);
+    counts.push_back(rows);
+  };
+
+  sqlQuery.insertInto("TBL", {"COL1", "COL2"});
+
+  BOOST_TEST(sqlQuery.insertStream([&](sqlWriter::parameterVector_t &row)
+                                   {
+                                     if (rowNumber == 5)
+                                     {
+                                       return false;
+                                     }
+                                     rowNumber++;
+                                     row[0] = rowNumber;
+                                     row[1] = std::string("R");
+                                     return true;
+                                   }, sink, 2) == 5);
+  BOOST_REQUIRE(statements.size() == 3);
+  BOOST_TEST(statements[0] == "INSERT INTO TBL (COL1, COL2) VALUES (1, 'R'), (2, 'R')");
+  BOOST_TEST(statements[2] == "INSERT INTO TBL (COL1, COL2) VALUES (5, 'R')");
+  BOOST_TEST(counts[2] == 1);
+
+  statements.clear();
+  counts.clear();
+
+  std::vector<sqlWriter::parameterVector_t> rows = { {1, 2}, {3, 4}, {5, 6} };
+
+  BOOST_TEST(sqlQuery.insertStream(rows, sink, 0, 50) == 3);
+  BOOST_REQUIRE(statements.size() == 2);
+  BOOST_TEST(statements[0] == "INSERT INTO TBL (COL1, COL2) VALUES (1, 2), (3, 4)");
+  BOOST_TEST(statements[1] == "INSERT INTO TBL (COL1, COL2) VALUES (5, 6)");
+
+  statements.clear();
+  counts.clear();
+
+  sqlQuery.setDialect(sqlWriter::POSTGRE);          // The RETURNING clause counts towards the limit.
+  sqlQuery.returning("COL1");
+  BOOST_TEST(sqlQuery.insertStream(rows, sink, 0, 65) == 3);
+  BOOST_REQUIRE(statements.size() == 2);
+  BOOST_TEST(statements[0] == "INSERT INTO TBL (COL1, COL2) VALUES (1, 2), (3, 4) RETURNING COL1");
+  BOOST_TEST(statements[0].size() <= 65);
+
+  statements.clear();
+  counts.clear();
+
+  BOOST_TEST(sqlQuery.insertStream(rows, sink, 0, 64) == 3);
+  BOOST_REQUIRE(statements.size() == 3);
+  BOOST_TEST(statements[0] == "INSERT INTO TBL (COL1, COL2) VALUES (1, 2) RETURNING COL1");
+
+    // ORACLE does not accept multi-row VALUES lists. INSERT ALL is used, which does not support RETURNING.
+
+  statements.clear();
+  counts.clear();
+
+  sqlQuery.setDialect(sqlWriter::ORACLE);
+  BOOST_CHECK_THROW(sqlQuery.insertStream(rows, sink, 2), GCL::CRuntimeAssert);
+
+  sqlQuery.resetQuery();
+  sqlQuery.insertInto("TBL", {"COL1", "COL2"});
+  BOOST_TEST(sqlQuery.insertStream(rows, sink, 2) == 3);
+  BOOST_REQUIRE(statements.size() == 2);
+  BOOST_TEST(statements[0] == "INSERT ALL INTO TBL (COL1, COL2) VALUES (1, 2) INTO TBL (COL1, COL2) VALUES (3, 4) "
+                              "SELECT 1 FROM DUAL");
+  BOOST_TEST(statements[1] == "INSERT ALL INTO TBL (COL1, COL2) VALUES (5, 6) SELECT 1 FROM DUAL");
+}
+
+BOOST_AUTO_TEST_CASE(bulkLoad)
+{
+  using namespace GCL;
+  sqlWriter sqlQuery;
+  std::string buffer;
+
+  sqlQuery.insertInto("TBL", {"COL1", "COL2"}).values({ {std::int32_t(1), "A\tB"}, {std::int32_t(2), "C\\D\n"} });
+
+  sqlQuery.bulkLoadCommand(buffer, sqlWriter::BULK_TEXT, "rows.tsv");
+  BOOST_TEST(buffer == "LOAD DATA LOCAL INFILE 'rows.tsv' INTO TABLE TBL FIELDS TERMINATED BY '\\t' ESCAPED BY '\\\\' "
+                       "LINES TERMINATED BY '\\n' (COL1, COL2)");
+
+  buffer.clear();
+  sqlQuery.bulkLoadPayload(buffer);
+  BOOST_TEST(buffer == "1\tA\\tB\n2\tC\\\\D\\n\n");
+
+  sqlQuery.setDialect(sqlWriter::POSTGRE);
+  buffer.clear();
+  sqlQuery.bulkLoadCommand(buffer, sqlWriter::BULK_BINARY);
+  BOOST_TEST(buffer == "COPY TBL (COL1, COL2) FROM STDIN WITH (FORMAT binary)");
+
+  buffer.clear();
+  sqlQuery.bulkLoadPayload(buffer, sqlWriter::BULK_BINARY);
+  BOOST_REQUIRE(buffer.size() == 19 + (2 + 8 + 4 + 3) + (2 + 8 + 4 + 4) + 2);
+  BOOST_TEST(buffer.compare(0, 11, std::string("PGCOPY\n\377\r\n\0", 11)) == 0);
+  BOOST_TEST(buffer.compare(19, 10, std::string("\0\2\0\0\0\4\0\0\0\1", 10)) == 0);
+  BOOST_TEST(buffer.substr(buffer.size() - 2) == std::string("\377\377"));
+
+  sqlWriter text;                       // \Z and \0 are MySQL only.
+  text.insertInto("TBL", {"COL1"}).values({ {"A\x1a\bB"} });
+  buffer.clear();
+  text.bulkLoadPayload(buffer);
+  BOOST_TEST(buffer == "A\\Z\bB\n");
+  text.setDialect(sqlWriter::POSTGRE);
+  buffer.clear();
+  text.bulkLoadPayload(buffer);
+  BOOST_TEST(buffer == "A\x1a\\bB\n");
+
+  sqlWriter numbers;
+  numbers.setDialect(sqlWriter::POSTGRE);
+  numbers.insertInto("TBL", {"COL1", "COL2"}).values({ {fixedDecimal_t(-123450, 2), decimal_t("0.00012")} });
+  buffer.clear();
+  numbers.bulkLoadPayload(buffer, sqlWriter::BULK_BINARY);
+  BOOST_REQUIRE(buffer.size() == 19 + 2 + 16 + 16 + 2);
+  BOOST_TEST(buffer.compare(21, 16, std::string("\0\0\0\14\0\2\0\0\100\0\0\2\4\322\23\210", 16)) == 0);  // -1234.50
+  BOOST_TEST(buffer.compare(37, 16, std::string("\0\0\0\14\0\2\377\377\0\0\0\5\0\1\7\320", 16)) == 0); // 0.00012
+}
+
+BOOST_AUTO_TEST_CASE(columnValues)
+{
+  using namespace GCL;
+  sqlWriter sqlQuery;
+  std::vector<std::int64_t> ids = {1, 2, 3};
+  std::vector<std::string_view> names = {"A", "B", "C"};
+  sqlBindBuffer bindBuffer;
+
+  sqlQuery.insertInto("TBL", {"ID", "NAME"}).values(sqlWriter::columnStorage_t{ids, names});
+  BOOST_TEST(sqlQuery.rowCount() == 3);
+  BOOST_TEST(sqlQuery.columnType(0) == sqlWriter::PT_I64);
+  BOOST_TEST(sqlQuery.string() == "INSERT INTO TBL (ID, NAME) VALUES (1, 'A'), (2, 'B'), (3, 'C')");
+
+  sqlQuery.preparedStatement(true);
+  sqlCompiledStatement statement = sqlQuery.compile();
+  BOOST_TEST(statement.sql() == "INSERT INTO TBL (ID, NAME)  VALUES ( ?, ?) ");
+  BOOST_REQUIRE(statement.slotCount() == 2);
+  BOOST_TEST(statement.slotType(1) == sqlWriter::PT_STRING);
+
+  sqlQuery.bindValues(bindBuffer);
+  BOOST_REQUIRE(bindBuffer.size() == 6);
+  BOOST_TEST(*static_cast<std::int64_t const *>(bindBuffer.buffer(4)) == 3);
+  BOOST_TEST(bindBuffer.text(5) == "C");
+}
+
+BOOST_AUTO_TEST_CASE(fixedDecimal)
+{
+  using namespace GCL;
+  sqlWriter sqlQuery;
+  sqlBindBuffer bindBuffer;
+  fixedDecimal_t value;
+  char text[fixedDecimal_t::MAX_CHARS];
+
+  BOOST_TEST(fixedDecimal_t(-5, 3).str() == "-0.005");
+  BOOST_TEST(fixedDecimal_t("12345.67").str() == "12345.67");
+  BOOST_TEST(fixedDecimal_t("+0.10").str() == "0.10");
+  BOOST_TEST(fixedDecimal_t("99999999999999999999999999999999999999").str() == "99999999999999999999999999999999999999");
+  BOOST_TEST(fixedDecimal_t("-12345678901234567890.123456789").str() == "-12345678901234567890.123456789");
+
+  auto const [end, ec] = fixedDecimal_t(1234, 2).to_chars(text, text + 4);
+  BOOST_TEST((ec == std::errc::value_too_large));
+
+  BOOST_TEST((fixedDecimal_t("1.5") == fixedDecimal_t("1.50")));
+  BOOST_TEST((fixedDecimal_t("-1.5") < fixedDecimal_t("1.25")));
+  BOOST_TEST((fixedDecimal_t("2") > fixedDecimal_t("1.99999999999999999999999999999999999")));
+
+  BOOST_TEST(!fixedDecimal_t::from_chars("1e5", value));
+  BOOST_TEST(!fixedDecimal_t::from_chars(".", value));
+  BOOST_TEST(!fixedDecimal_t::from_chars("123456789012345678901234567890123456789", value));
+  BOOST_CHECK_THROW(fixedDecimal_t("abc"), GCL::runtime_error);
+
+  BOOST_TEST(std::holds_alternative<fixedDecimal_t>(sqlWriter::makeDecimal("1.25")));
+  BOOST_TEST(std::holds_alternative<decimal_t>(sqlWriter::makeDecimal("123456789012345678901234567890123456789.5")));
+  BOOST_TEST(sqlWriter::parameterType(sqlWriter::makeDecimal("1.25")) == sqlWriter::PT_DECIMAL);
+
+  sqlQuery.insertInto("TBL", {"ID", "PRICE"}).values({ {std::int32_t(1), fixedDecimal_t(1999, 2)} });
+  BOOST_TEST(sqlQuery.string() == "INSERT INTO TBL (ID, PRICE) VALUES (1, 19.99)");
+
+  sqlQuery.resetQuery();
+  sqlQuery.select({"ID"}).from("TBL").where("PRICE", GCL::gt, fixedDecimal_t(-25, 1));
+  BOOST_TEST(sqlQuery.string() == "SELECT ID FROM TBL WHERE (PRICE > -2.5)");
+
+  bindBuffer.push_back(sqlWriter::parameter_t(fixedDecimal_t(-5, 3)));
+  BOOST_TEST(bindBuffer.type(0) == sqlWriter::PT_DECIMAL);
+  BOOST_TEST(bindBuffer.text(0) == "-0.005");
+}
+
+BOOST_AUTO_TEST_CASE(literals)
+{
+  using namespace GCL;
+  using namespace std::chrono;
+  sqlWriter sqlQuery;
+  std::string buffer;
+  timePoint_t const tp = sys_days{year(2024) / 2 / 29} + hours(12) + minutes(34) + seconds(56) + milliseconds(789);
+
+  appendLiteral(buffer, 1.5);
+  BOOST_TEST(buffer == "1.5");
+  buffer.clear();
+  appendLiteral(buffer, 0.1f);
+  BOOST_TEST(buffer == "0.1");
+  buffer.clear();
+  appendLiteral(buffer, std::int8_t(-128));
+  BOOST_TEST(buffer == "-128");
+
+  buffer.clear();
+  appendDateTimeLiteral(buffer, tp);
+  BOOST_TEST(buffer == "2024-02-29 12:34:56");
+  buffer.clear();
+  appendDateTimeLiteral(buffer, timePoint_t(seconds(-1)));
+  BOOST_TEST(buffer == "1969-12-31 23:59:59");
+  buffer.clear();
+  appendDateLiteral(buffer, sys_days{year(1700) / 3 / 1});
+  BOOST_TEST(buffer == "1700-03-01");
+  buffer.clear();
+  appendTimeLiteral(buffer, tp);
+  BOOST_TEST(buffer == "12:34:56");
+
+  sqlQuery.insertInto("TBL", {"F", "D", "T"}).values({ {0.25, date_t(tp), dateTime_t(tp)} });
+  BOOST_TEST(sqlQuery.string() == "INSERT INTO TBL (F, D, T) VALUES (0.25, '2024-02-29', '2024-02-29 12:34:56')");
+}
+
+BOOST_AUTO_TEST_CASE(stringLiterals)
+{
+  using namespace GCL;
+  sqlWriter sqlQuery;
+  std::string buffer;
+  std::string const longText(100, 'x');
+
+  appendStringLiteral(buffer, "O'Brien \\ \"x\"\n", SL_MYSQL);
+  BOOST_TEST(buffer == "'O\\'Brien \\\\ \\\"x\\\"\\n'");
+
+  buffer.clear();
+  appendStringLiteral(buffer, "O'Brien \\", SL_STANDARD);
+  BOOST_TEST(buffer == "'O''Brien \\'");
+
+  buffer = "x = ";
+  appendStringLiteral(buffer, "O'Brien \\", SL_POSTGRE);
+  BOOST_TEST(buffer == "x = E'O''Brien \\\\'");
+
+  buffer.clear();
+  appendStringLiteral(buffer, longText + "'" + longText, SL_POSTGRE);
+  BOOST_TEST(buffer == "'" + longText + "''" + longText + "'");
+
+  buffer.clear();
+  appendStringLiteral(buffer, std::string_view("a\0b", 3), SL_MYSQL);
+  BOOST_TEST(buffer == "'a\\0b'");
+
+  sqlQuery.select({"ID"}).from("TBL").where("NAME", GCL::eq, "O'Brien");
+  BOOST_TEST(sqlQuery.string() == "SELECT ID FROM TBL WHERE (NAME = 'O\\'Brien')");
+  sqlQuery.setDialect(sqlWriter::POSTGRE);
+  BOOST_TEST(sqlQuery.string() == "SELECT ID FROM TBL WHERE (NAME = 'O''Brien')");
+}
+
+BOOST_AUTO_TEST_CASE(databaseMap)
+{
+  using namespace GCL;
+  sqlDatabaseMap::TDatabaseMap definition;
+
+  definition["USERS"].tableName = {"USERS", "tbl_users"};
+  definition["USERS"].columnData["ID"].columnName = {"ID", "user_id"};
+  definition["USERS"].columnData["NAME"].columnName = {"NAME", "user_name"};
+  definition["ORDERS"].tableName.first = "ORDERS";
+  definition["ORDERS"].columnData["ID"].columnName = {"ID", "order_id"};
+  definition["ORDERS"].columnData["TOTAL"].columnName.first = "TOTAL";
+
+  auto const map = std::make_shared<sqlDatabaseMap const>(std::move(definition));
+
+  BOOST_TEST(map->tableName("USERS") == "tbl_users");
+  BOOST_TEST(map->tableName("ORDERS") == "ORDERS");
+  BOOST_TEST(map->tableName("OTHER") == "OTHER");
+  BOOST_TEST(map->columnName("ORDERS", "ID") == "order_id");
+  BOOST_TEST(map->columnName("USERS.ID") == "user_id");
+  BOOST_TEST(map->columnName("ID") == "ID");                 // Maps differently in each table.
+  BOOST_TEST(map->columnName("NAME") == "user_name");
+  BOOST_TEST(map->columnName("TOTAL") == "TOTAL");
+
+  sqlWriter sqlQuery;
+  sqlQuery.databaseMap(map);
+  sqlWriter copy;
+  copy.databaseMap(sqlQuery.databaseMap());
+  BOOST_TEST(copy.databaseMap().get() == map.get());
+  BOOST_TEST(copy.getTableMappedName("USERS") == "tbl_users");
+
+  copy.deleteFrom("USERS").where("NAME", eq, 1);             // The map is not applied when rendering.
+  BOOST_TEST(copy.string() == "DELETE FROM USERS WHERE (NAME = 1)");
+  copy.resetQuery();
+  copy.select({"NAME"}).from("USERS").orderBy("NAME", ASC);
+  BOOST_TEST(copy.string() == "SELECT NAME FROM USERS ORDER BY NAME ASC ");
+
+  BOOST_TEST(sqlQuery.createTable("ITEMS"));
+  BOOST_TEST(!sqlQuery.createTable("USERS"));
+  BOOST_TEST(sqlQuery.databaseMap().get() != map.get());
+  BOOST_TEST(sqlQuery.getTableMappedName("USERS") == "tbl_users");
+  BOOST_TEST(copy.databaseMap().get() == map.get());
+}
+
+BOOST_AUTO_TEST_CASE(arena)
+{
+  using namespace GCL;
+  sqlWriter sqlQuery(1024);
+
+  BOOST_TEST(sqlQuery.hasArena());
+  sqlQuery.setDialect(sqlWriter::MYSQL);
+
+  sqlWriter subQuery;
+  subQuery.select({"ID"}).from("ORDERS");
+  sqlQuery.select({"ID"}).from(std::move(subQuery), "O").where(where_v("ID", gt, 1), AND, where_v("ID", lt, 5));
+  std::string const first = sqlQuery.string();
+  BOOST_TEST(first == "SELECT ID FROM (SELECT ID FROM ORDERS) AS O WHERE  ((ID > 1) AND (ID < 5))");
+
+  sqlQuery.resetQuery();
+  BOOST_TEST(sqlQuery.hasArena());
+
+  subQuery.resetQuery();
+  subQuery.select({"ID"}).from("ORDERS");
+  sqlQuery.select({"ID"}).from(std::move(subQuery), "O").where(where_v("ID", gt, 1), AND, where_v("ID", lt, 5));
+  BOOST_TEST(sqlQuery.string() == first);
+}
+
+BOOST_AUTO_TEST_CASE(inList)
+{
+  using namespace GCL;
+  sqlWriter sqlQuery;
+  sqlWriter::parameterVector_t ids = {1, 2, 3, 4, 5};
+
+  sqlQuery.setDialect(sqlWriter::MYSQL);
+  sqlQuery.inList(sqlWriter::IN_CHUNKED, 10, 2);
+  sqlQuery.select({"ID"}).from("TBL").where("ID", in, ids);
+  BOOST_TEST(sqlQuery.string() == "SELECT ID FROM TBL WHERE (ID IN (1, 2, 3, 4, 5))");
+
+  sqlQuery.inList(sqlWriter::IN_CHUNKED, 3, 2);
+  BOOST_TEST(sqlQuery.string() == "SELECT ID FROM TBL WHERE ((ID IN (1, 2)) OR (ID IN (3, 4)) OR (ID IN (5)))");
+
+  sqlQuery.inList(sqlWriter::IN_VALUES, 3);
+  BOOST_TEST(sqlQuery.string() ==
+             "SELECT ID FROM TBL WHERE (ID IN (SELECT column_0 FROM (VALUES ROW(1), ROW(2), ROW(3), ROW(4), ROW(5)) AS t))");
+
+  sqlQuery.setDialect(sqlWriter::POSTGRE);
+  sqlQuery.inList(sqlWriter::IN_AUTO, 3);
+  sqlQuery.resetQuery();
+  sqlQuery.select({"ID"}).from("TBL").where("NAME", nin, sqlWriter::parameterVector_t{"a", "b\"c", "d", "e"});
+  BOOST_TEST(sqlQuery.string() == "SELECT ID FROM TBL WHERE (NAME <> ALL(E'{\"a\",\"b\\\\\"c\",\"d\",\"e\"}'))");
+
+  sqlBindBuffer buffer(sqlWriter::POSTGRE);
+  sqlQuery.preparedStatement(true);
+  BOOST_TEST(sqlQuery.string() == "SELECT ID FROM TBL WHERE (NAME <> ALL(?))");
+  sqlQuery.bindValues(buffer);
+  BOOST_REQUIRE(buffer.size() == 1);
+  BOOST_TEST(buffer.text(0) == "{\"a\",\"b\\\"c\",\"d\",\"e\"}");
+
+  std::list<sqlWriter::bindParameter_t> params;
+  sqlQuery.bindValues(params);
+  BOOST_REQUIRE(params.size() == 1);
+  BOOST_TEST(std::holds_alternative<sqlWriter::parameterVariant_ref>(params.front()));
+
+  params.clear();
+  sqlQuery.setDialect(sqlWriter::ORACLE);
+  sqlQuery.inList(sqlWriter::IN_AUTO, 3, 3);
+  BOOST_TEST(sqlQuery.string() == "SELECT ID FROM TBL WHERE ((NAME NOT IN (?, ?, ?)) AND (NAME NOT IN (?)))");
+  sqlQuery.bindValues(params);
+  BOOST_TEST(params.size() == 4);
+
+  std::vector<std::string> statements;
+  sqlQuery.preparedStatement(false);
+  sqlQuery.setDialect(sqlWriter::MYSQL);
+  sqlQuery.inList(sqlWriter::IN_TEMP_TABLE, 0, 3);
+  sqlQuery.resetQuery();
+  sqlQuery.select({"ID"}).from("TBL").where("T.ID", in, ids);
+  BOOST_TEST(sqlQuery.string() == "SELECT ID FROM TBL WHERE (T.ID IN (SELECT v FROM tmp_in_T_ID))");
+  BOOST_TEST(sqlQuery.inListSetup([&](std::string_view statement, std::size_t) { statements.emplace_back(statement); }) == 1);
+  BOOST_REQUIRE(statements.size() == 4);
+  BOOST_TEST(statements[0] == "DROP TEMPORARY TABLE IF EXISTS tmp_in_T_ID");
+  BOOST_TEST(statements[1] == "CREATE TEMPORARY TABLE tmp_in_T_ID (v BIGINT)");
+  BOOST_TEST(statements[3] == "INSERT INTO tmp_in_T_ID (v) VALUES (4), (5)");
+}
+
+BOOST_AUTO_TEST_CASE(seekAfter)
+{
+  using namespace GCL;
+  sqlWriter sqlQuery;
+  sqlBindBuffer buffer(sqlWriter::POSTGRE);
+
+  sqlQuery.setDialect(sqlWriter::POSTGRE);
+  sqlQuery.select({"ID", "NAME"}).from("TBL").where("TYPE", eq, 1).orderBy({{"NAME", ASC}, {"ID", ASC}}).limit(100);
+  BOOST_TEST(sqlQuery.string() == "SELECT ID, NAME FROM TBL WHERE (TYPE = 1) ORDER BY NAME ASC , ID ASC  LIMIT 100");
+
+  sqlQuery.seekAfter({"Smith", std::int32_t(42)});
+  BOOST_TEST(sqlQuery.string() ==
+             "SELECT ID, NAME FROM TBL WHERE (TYPE = 1) AND ((NAME, ID) > ('Smith', 42)) ORDER BY NAME ASC , ID ASC  LIMIT 100");
+
+  sqlQuery.preparedStatement(true);
+  BOOST_TEST(sqlQuery.string() ==
+             "SELECT ID, NAME FROM TBL WHERE (TYPE = 1) AND ((NAME, ID) > (?, ?)) ORDER BY NAME ASC , ID ASC  LIMIT 100");
+  sqlQuery.bindValues(buffer);
+  BOOST_REQUIRE(buffer.size() == 2);
+  BOOST_TEST(buffer.text(0) == "Smith");
+  BOOST_TEST(buffer.type(1) == sqlWriter::PT_I32);
+
+  sqlQuery.resetQuery();
+  sqlQuery.setDialect(sqlWriter::ORACLE);
+  sqlQuery.select({"ID"}).from("TBL").orderBy({{"NAME", DESC}, {"ID", ASC}}).limit(10);
+  sqlQuery.seekAfter({"Smith", std::int32_t(42)});
+  BOOST_TEST(sqlQuery.string() ==
+             "SELECT ID FROM TBL WHERE ((NAME < ?) OR (NAME = ? AND ID > ?)) ORDER BY NAME DESC , ID ASC  FETCH FIRST 10 ROWS ONLY");
+  buffer.clear();
+  sqlQuery.bindValues(buffer);
+  BOOST_REQUIRE(buffer.size() == 3);
+  BOOST_TEST(buffer.text(1) == "Smith");
+
+  std::list<sqlWriter::bindParameter_t> params;
+  sqlQuery.bindValues(params);
+  BOOST_REQUIRE(params.size() == 3);
+  BOOST_TEST(std::get<std::string>(std::get<sqlWriter::parameter_ref>(*std::next(params.begin())).get()) == "Smith");
+  BOOST_TEST(std::get<std::int32_t>(std::get<sqlWriter::parameter_ref>(params.back()).get()) == 42);
+}
+
+BOOST_AUTO_TEST_CASE(batch)
+{
+  using namespace GCL;
+  sqlBatch batch(sqlWriter::POSTGRE);
+  sqlBindBuffer buffer(sqlWriter::POSTGRE);
+
+  for (std::int32_t index = 1; index <= 3; index++)
+  {
+    sqlWriter insert;
+    insert.preparedStatement(true).insertInto("TBL", {"ID", "NAME"}).values({ {index, "N" + std::to_string(index)} });
+    batch.add(std::move(insert));
+  };
+  batch.savepoint("A");
+
+  sqlWriter update;
+  update.preparedStatement(true).update("TBL").set("NAME", "X").where("ID", eq, 2);
+  batch.add(std::move(update));
+  batch.releaseSavepoint("A");
+
+  BOOST_TEST(batch.size() == 4);
+  BOOST_TEST(batch.string() == "BEGIN;\n"
+                               "INSERT INTO TBL (ID, NAME) VALUES (?, ?), (?, ?), (?, ?);\n"
+                               "SAVEPOINT A;\n"
+                               "UPDATE TBL SET NAME = ? WHERE (ID = 2);\n"
+                               "RELEASE SAVEPOINT A;\n"
+                               "COMMIT;\n");
+
+  batch.bindValues(buffer);
+  BOOST_REQUIRE(buffer.size() == 7);
+  BOOST_TEST(buffer.text(5) == "N3");
+  BOOST_TEST(buffer.text(6) == "X");
+
+  sqlBatch oracle(sqlWriter::ORACLE);         // ORACLE does not support multi-row VALUES. The inserts are not merged.
+  for (std::int32_t index = 1; index <= 2; index++)
+  {
+    sqlWriter insert;
+    insert.insertInto("TBL", {"ID"}).values({ {index} });
+    oracle.add(std::move(insert));
+  };
+
+  BOOST_TEST(oracle.size() == 2);
+  BOOST_TEST(oracle.string() == "BEGIN\n"
+                                "INSERT INTO TBL (ID) VALUES (1);\n"
+                                "INSERT INTO TBL (ID) VALUES (2);\n"
+                                "COMMIT;\n"
+                                "END;\n");
+}
+
+BOOST_AUTO_TEST_CASE(upsertRows)
+{
+  using namespace GCL;
+  auto const query = [](sqlWriter::EDialect dialect)
+  {
+    sqlWriter writer;
+    writer.setDialect(dialect);
+    writer.upsert("TBL", {"ID", "NAME", "QTY"}).values({ {1, "A", 10}, {2, "B", 20} }).onConflict({"ID"});
+    return writer.string();
+  };
+
+  BOOST_TEST(query(sqlWriter::MYSQL) == "INSERT INTO TBL (ID, NAME, QTY) VALUES (1, 'A', 10), (2, 'B', 20) "
+                                        "ON DUPLICATE KEY UPDATE NAME = VALUES(NAME), QTY = VALUES(QTY)");
+  BOOST_TEST(query(sqlWriter::POSTGRE) == "INSERT INTO TBL (ID, NAME, QTY) VALUES (1, 'A', 10), (2, 'B', 20) "
+                                          "ON CONFLICT (ID) DO UPDATE SET NAME = EXCLUDED.NAME, QTY = EXCLUDED.QTY");
+  BOOST_TEST(query(sqlWriter::MICROSOFT) == "MERGE INTO TBL AS TGT USING (VALUES (1, 'A', 10), (2, 'B', 20)) AS SRC (ID, NAME, QTY) "
+                                            "ON (TGT.ID = SRC.ID) WHEN MATCHED THEN UPDATE SET TGT.NAME = SRC.NAME, TGT.QTY = SRC.QTY "
+                                            "WHEN NOT MATCHED THEN INSERT (ID, NAME, QTY) VALUES (SRC.ID, SRC.NAME, SRC.QTY);");
+  BOOST_TEST(query(sqlWriter::ORACLE) == "MERGE INTO TBL TGT USING (SELECT 1 ID, 'A' NAME, 10 QTY FROM DUAL UNION ALL "
+                                         "SELECT 2 ID, 'B' NAME, 20 QTY FROM DUAL) SRC "
+                                         "ON (TGT.ID = SRC.ID) WHEN MATCHED THEN UPDATE SET TGT.NAME = SRC.NAME, TGT.QTY = SRC.QTY "
+                                         "WHEN NOT MATCHED THEN INSERT (ID, NAME, QTY) VALUES (SRC.ID, SRC.NAME, SRC.QTY)");
+
+  sqlWriter writer;
+  writer.setDialect(sqlWriter::POSTGRE);
+  writer.preparedStatement(true).upsert("TBL", {"ID", "NAME"}).values({ {1, "A"}, {2, "B"} }).onConflict({"ID", "NAME"});
+  BOOST_TEST(writer.string() == "INSERT INTO TBL (ID, NAME) VALUES (?, ?), (?, ?) ON CONFLICT (ID, NAME) DO NOTHING");
+
+  sqlBindBuffer buffer(sqlWriter::POSTGRE);
+  writer.bindValues(buffer);
+  BOOST_REQUIRE(buffer.size() == 4);
+  BOOST_TEST(buffer.text(3) == "B");
+
+    // The list form has one parameter per placeholder, in the same order.
+
+  std::list<sqlWriter::bindParameter_t> params;
+  writer.bindValues(params);
+  BOOST_REQUIRE(params.size() == 4);
+  BOOST_TEST(std::get<std::string>(std::get<sqlWriter::parameter_ref>(params.back()).get()) == "B");
+
+  writer.resetQuery();
+  writer.preparedStatement(false).upsert("TBL", {"ID", "NAME"}).onConflict({"ID"});
+  BOOST_CHECK_THROW(writer.string(), std::exception);
+
+    // Chunked upserts.
+
+  std::vector<std::string> statements;
+  std::size_t const rows = writer.insertStream([next = 0](sqlWriter::parameterVector_t &row) mutable
+                                               {
+                                                 row = { next, "N" };
+                                                 return next++ < 5;
+                                               },
+                                               [&](std::string_view text, std::size_t) { statements.emplace_back(text); }, 2);
+  BOOST_TEST(rows == 5);
+  BOOST_REQUIRE(statements.size() == 3);
+  BOOST_TEST(statements[2] == "INSERT INTO TBL (ID, NAME) VALUES (4, 'N') ON CONFLICT (ID) DO UPDATE SET NAME = EXCLUDED.NAME");
+
+    // The conflict tail counts towards the byte limit. Two rows with the tail are 104 bytes.
+
+  for (std::size_t maxBytes : {104, 103})
+  {
+    statements.clear();
+    writer.insertStream([next = 0](sqlWriter::parameterVector_t &row) mutable
+                        {
+                          row = { next, "N" };
+                          return next++ < 2;
+                        },
+                        [&](std::string_view text, std::size_t) { statements.emplace_back(text); }, 0, maxBytes);
+    BOOST_TEST(statements.size() == ((maxBytes == 104) ? 1 : 2));
+    for (auto const &statement : statements)
+    {
+      BOOST_TEST(statement.size() <= maxBytes);
+    };
+  };
+}
+
+namespace
+{
+  using GCL::sqlStaticStatement;
+  using GCL::sqlWriter;
+
+  constexpr sqlStaticStatement staticSelect = sqlStaticStatement(sqlWriter::MYSQL)
+    .select({"ID", "NAME"}).from("TBL").where("ID", GCL::gt, sqlWriter::PT_I64).andWhere("NAME", GCL::neq, sqlWriter::PT_STRING)
+    .orderBy("NAME").limit(10);
+  constexpr sqlStaticStatement staticUpdate = sqlStaticStatement(sqlWriter::POSTGRE)
+    .update("TBL").set("NAME", sqlWriter::PT_STRING).set("QTY", sqlWriter::PT_I32).where("ID", GCL::eq, sqlWriter::PT_I64);
+
+  static_assert(staticSelect.sql() == "SELECT ID, NAME FROM TBL WHERE  ((ID > ?) AND (NAME != ?)) ORDER BY NAME ASC  LIMIT 10 ");
+  static_assert(staticSelect.slotCount() == 2);
+  static_assert(staticSelect.accepts<std::int64_t, std::string>());
+  static_assert(!staticSelect.accepts<std::int32_t, std::string>());
+  static_assert(!staticSelect.accepts<std::int64_t>());
+}
+
+BOOST_AUTO_TEST_CASE(staticStatement)
+{
+  using namespace GCL;
+  sqlWriter writer;
+
+    // The same layout as sqlWriter. (sqlWriter renders numbers in the where clause inline.)
+
+  writer.setDialect(sqlWriter::POSTGRE);
+  writer.preparedStatement(true);
+  writer.update("TBL").set({ {"NAME", std::string("A")}, {"QTY", std::int32_t(1)} }).where("ID", eq, std::string("1"));
+  BOOST_TEST(staticUpdate.sql() == writer.string());
+  BOOST_TEST(staticUpdate.sql() == "UPDATE TBL SET NAME = ?, QTY = ? WHERE (ID = ?)");
+
+  constexpr sqlStaticStatement top = sqlStaticStatement(sqlWriter::MICROSOFT).select({"ID"}).from("TBL").limit(5);
+  BOOST_TEST(top.sql() == "SELECT TOP 5 ID FROM TBL");
+
+  sqlBindBuffer buffer(sqlWriter::POSTGRE);
+  std::string const name = "B";
+  bindStatic<staticUpdate>(buffer, name, std::int32_t(7), std::int64_t(3));
+  BOOST_REQUIRE(buffer.size() == 3);
+  BOOST_TEST(buffer.text(0) == "B");
+  BOOST_TEST(buffer.type(1) == sqlWriter::PT_I32);
+
+  sqlCompiledStatement compiled = staticUpdate.compile();
+  BOOST_TEST(compiled.slotCount() == 3);
+  BOOST_TEST(compiled.slotType(2) == sqlWriter::PT_I64);
+
+  BOOST_CHECK_THROW(sqlStaticStatement().from("TBL"), GCL::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(fingerprint)
+{
+  using namespace GCL;
+  sqlWriter query1;
+  sqlWriter query2;
+  sqlWriter query3;
+
+  query1.setDialect(sqlWriter::POSTGRE);
+  query2.setDialect(sqlWriter::POSTGRE);
+  query3.setDialect(sqlWriter::POSTGRE);
+
+  query1.select({"ID"}).from("TBL").where(where_v("NAME", eq, std::string("it's")), AND, where_v("QTY", gt, 1.5e-3)).limit(10);
+  query2.select({"ID"}).from("TBL").where(where_v("NAME", eq, std::string("b\\c")), AND, where_v("QTY", gt, 7)).limit(20);
+  query3.select({"ID"}).from("TBL").where(where_v("NAME", eq, std::string("a")), OR, where_v("QTY", gt, 1)).limit(10);
+
+  BOOST_TEST(query1.fingerprint() == query2.fingerprint());
+  BOOST_TEST(query1.fingerprint() != query3.fingerprint());
+  BOOST_TEST(query1.shapeKey() != query2.shapeKey());
+  BOOST_TEST(query1.fingerprint128().first == query1.fingerprint());
+  BOOST_TEST((query1.fingerprint128() == query2.fingerprint128()));
+
+  BOOST_TEST(query1.normalisedText() == "SELECT ID FROM TBL WHERE  ((NAME = ?) AND (QTY > ?)) LIMIT ?");
+  BOOST_TEST(query1.normalisedText() == query2.normalisedText());
+
+  std::uint64_t const literal = query3.fingerprint();
+  query3.preparedStatement(true);
+  BOOST_TEST(query3.fingerprint() != literal);
+
+  std::uint64_t const shape = query1.shapeKey();      // The map snapshot is only part of the cache key.
+  std::uint64_t const print = query1.fingerprint();
+  query1.databaseMap(std::make_shared<sqlDatabaseMap const>(sqlDatabaseMap::TDatabaseMap()));
+  BOOST_TEST(query1.fingerprint() == print);
+  BOOST_TEST(query1.shapeKey() != shape);
+}
+
+BOOST_AUTO_TEST_CASE(serialise)
+{
+  using namespace GCL;
+  sqlWriter query1(1024);
+  sqlWriter subQuery;
+  sqlWriter query2;
+
+  subQuery.select({"ID"}).from("OTHER").where("CODE", in, sqlWriter::parameterVector_t{1, 2, 3});
+  query1.setDialect(sqlWriter::POSTGRE);
+  query1.select({"ID", "NAME"}).from("TBL", "T")
+        .join({{"T.ID", "O.TBL_ID", JOIN_LEFT, sqlWriter::tableName_t("OWNER", "O"), ""}})
+        .where(where_v("NAME", eq, std::string("b\\c")),
+               AND,
+               where_v(where_v("ID", in, std::move(subQuery)), OR, where_v("QTY", gt, sqlWriter::makeDecimal("12.50"))))
+        .groupBy("NAME").orderBy("NAME", DESC).limit(10).offset(20).forUpdate();
+
+  std::string const buffer = sqlSerialiser::serialise(query1);
+  sqlWriter restored = sqlSerialiser::deserialise(buffer);
+
+  BOOST_TEST(restored.string() == query1.string());
+  BOOST_TEST(restored.shapeKey() == query1.shapeKey());
+  BOOST_TEST(restored.hasArena());
+
+  query2.upsert("TBL", {"ID", "NAME"}).values({{1, std::string("a")}, {2, std::string("b")}}).onConflict({"ID"});
+  query2.preparedStatement(true);
+  BOOST_TEST(sqlSerialiser::deserialise(sqlSerialiser::serialise(query2)).string() == query2.string());
+
+  BOOST_CHECK_THROW(sqlSerialiser::deserialise(std::string_view(buffer).substr(0, buffer.size() - 1)), std::exception);
+  BOOST_CHECK_THROW(sqlSerialiser::deserialise("GSQX"), std::exception);
+}
+
 BOOST_AUTO_TEST_SUITE_END()